@@ -0,0 +1,130 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Structure: ItemHoverKernel
+
+#include "ItemHoverKernel.h"
+#include "Async/ParallelFor.h"
+
+// Mesma curva de GetItemInterpAlpha (MasterItem.cpp)
+static FORCEINLINE float GetKernelInterpAlpha(float DeltaTime, float InterpSpeed)
+{
+	return InterpSpeed <= 0.0f ? 1.0f : 1.0f - FMath::Exp(-InterpSpeed * DeltaTime);
+}
+
+void FItemHoverKernel::Reset()
+{
+	DeltaTimes.Reset();
+	TargetHeights.Reset();
+	FloatSpeeds.Reset();
+	ResetSpeeds.Reset();
+	SpinPitch.Reset();
+	SpinYaw.Reset();
+	SpinRoll.Reset();
+	Heights.Reset();
+	Pitches.Reset();
+	Yaws.Reset();
+	Rolls.Reset();
+	Flags.Reset();
+	SpinMask.Reset();
+}
+
+int32 FItemHoverKernel::Add(float DeltaTime, float Height, float TargetHeight, float FloatSpeed, const FRotator& Rotation,
+	float SpinSpeed, EDirectionRotation SpinAxis, float ResetSpeed, uint8 InFlags)
+{
+	DeltaTimes.Add(DeltaTime);
+	// Sem flutuação o alvo é a própria altura: a interpolação vira identidade, sem desvio no kernel
+	TargetHeights.Add((InFlags & Float) ? TargetHeight : Height);
+	FloatSpeeds.Add(FloatSpeed);
+	ResetSpeeds.Add(ResetSpeed);
+	SpinPitch.Add(SpinAxis == EDirectionRotation::Z ? SpinSpeed : 0.0f);
+	SpinYaw.Add(SpinAxis == EDirectionRotation::Y ? SpinSpeed : 0.0f);
+	SpinRoll.Add(SpinAxis == EDirectionRotation::X ? SpinSpeed : 0.0f);
+	Heights.Add(Height);
+	Pitches.Add(Rotation.Pitch);
+	Yaws.Add(Rotation.Yaw);
+	Rolls.Add(Rotation.Roll);
+	SpinMask.Add(0.0f);
+	return Flags.Add(InFlags);
+}
+
+void FItemHoverKernel::Run(bool bParallel)
+{
+	const int32 NumEntries = Num();
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumEntries, ChunkSize);
+	ParallelFor(NumChunks, [this, NumEntries](int32 ChunkIndex)
+	{
+		const int32 Start = ChunkIndex * ChunkSize;
+		RunChunk(Start, FMath::Min(Start + ChunkSize, NumEntries));
+	}, bParallel && NumChunks > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+}
+
+void FItemHoverKernel::RunChunk(int32 Start, int32 End)
+{
+	// Passo 1: máquina de estados da rotação (reset até zero antes de girar); poucos itens entram no reset
+	for (int32 Index = Start; Index < End; ++Index)
+	{
+		uint8 ItemFlags = Flags[Index];
+		SpinMask[Index] = 0.0f;
+		if (!(ItemFlags & Rotate))
+		{
+			continue;
+		}
+
+		if (ItemFlags & EasyMode)
+		{
+			if (!(ItemFlags & Rotating))
+			{
+				ItemFlags = (ItemFlags | Rotating) & ~Resetting;
+			}
+		}
+		else
+		{
+			if ((ItemFlags & ResetRotation) && !(ItemFlags & (Resetting | Rotating)))
+			{
+				ItemFlags |= Resetting;
+			}
+
+			if (ItemFlags & Resetting)
+			{
+				// ItemRInterpTo até FRotator::ZeroRotator
+				const float Alpha = GetKernelInterpAlpha(DeltaTimes[Index], ResetSpeeds[Index]);
+				const float Pitch = FRotator::NormalizeAxis(Pitches[Index] + FRotator::NormalizeAxis(-Pitches[Index]) * Alpha);
+				const float Yaw = FRotator::NormalizeAxis(Yaws[Index] + FRotator::NormalizeAxis(-Yaws[Index]) * Alpha);
+				const float Roll = FRotator::NormalizeAxis(Rolls[Index] + FRotator::NormalizeAxis(-Rolls[Index]) * Alpha);
+				if (FMath::Abs(Pitch) <= 1.0f && FMath::Abs(Yaw) <= 1.0f && FMath::Abs(Roll) <= 1.0f)
+				{
+					Pitches[Index] = Yaws[Index] = Rolls[Index] = 0.0f;
+					ItemFlags = (ItemFlags | Rotating) & ~Resetting;
+				}
+				else
+				{
+					Pitches[Index] = Pitch;
+					Yaws[Index] = Yaw;
+					Rolls[Index] = Roll;
+					Flags[Index] = ItemFlags;
+					continue;
+				}
+			}
+
+			if (!(ItemFlags & ResetRotation) && !(ItemFlags & Rotating))
+			{
+				ItemFlags |= Rotating | CapturedOriginal;
+			}
+		}
+
+		SpinMask[Index] = (ItemFlags & Rotating) ? 1.0f : 0.0f;
+		Flags[Index] = ItemFlags;
+	}
+
+	// Passo 2: altura e giro sem desvios, em arrays contíguos (vetorizável pelo compilador)
+	for (int32 Index = Start; Index < End; ++Index)
+	{
+		const float DeltaTime = DeltaTimes[Index];
+		const float FloatSpeed = FloatSpeeds[Index];
+		const float Alpha = FloatSpeed <= 0.0f ? 1.0f : 1.0f - FMath::Exp(-FloatSpeed * DeltaTime);
+		Heights[Index] += (TargetHeights[Index] - Heights[Index]) * Alpha;
+
+		const float Spin = SpinMask[Index] * DeltaTime;
+		Pitches[Index] += SpinPitch[Index] * Spin;
+		Yaws[Index] += SpinYaw[Index] * Spin;
+		Rolls[Index] += SpinRoll[Index] * Spin;
+	}
+}
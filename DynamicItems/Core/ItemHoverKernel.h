@@ -0,0 +1,64 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Structure: ItemHoverKernel
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AndromedaSystemsC/DynamicItems/Structure/ItemEnums.h"
+
+/**
+ * Flutuação e rotação do modo cosmético em structure-of-arrays
+ * O UItemManagerSubsystem empacota os itens com proxy ativo, roda o kernel (ParallelFor por blocos)
+ * e aplica o resultado no game thread; mesma matemática de AMasterItem::UpdateFloating/UpdateRotation
+ */
+class ANDROMEDA_API FItemHoverKernel
+{
+public:
+	enum EFlags : uint8
+	{
+		Float				= 1 << 0,
+		Rotate				= 1 << 1,
+		ResetRotation		= 1 << 2, // RotationSettings.Reset
+		EasyMode			= 1 << 3,
+		Rotating			= 1 << 4, // FItemRuntimeState::bIsRotating
+		Resetting			= 1 << 5, // FItemRuntimeState::bIsResettingRotation
+		CapturedOriginal	= 1 << 6, // Saída: começou a girar sem reset, OriginalRotation = rotação de entrada
+	};
+
+	// Itens por tarefa do ParallelFor
+	static constexpr int32 ChunkSize = 512;
+
+	void Reset();
+
+	// Retorna o índice da entrada (mesma ordem de leitura dos resultados)
+	int32 Add(float DeltaTime, float Height, float TargetHeight, float FloatSpeed, const FRotator& Rotation,
+		float SpinSpeed, EDirectionRotation SpinAxis, float ResetSpeed, uint8 InFlags);
+
+	void Run(bool bParallel);
+
+	FORCEINLINE int32 Num() const { return Flags.Num(); }
+	FORCEINLINE float GetHeight(int32 Index) const { return Heights[Index]; }
+	FORCEINLINE FRotator GetRotation(int32 Index) const { return FRotator(Pitches[Index], Yaws[Index], Rolls[Index]); }
+	FORCEINLINE uint8 GetFlags(int32 Index) const { return Flags[Index]; }
+
+private:
+	void RunChunk(int32 Start, int32 End);
+
+	// Entradas
+	TArray<float> DeltaTimes;
+	TArray<float> TargetHeights;
+	TArray<float> FloatSpeeds;
+	TArray<float> ResetSpeeds;
+	TArray<float> SpinPitch; // Velocidade de giro já separada por eixo (0 nos outros dois)
+	TArray<float> SpinYaw;
+	TArray<float> SpinRoll;
+
+	// Entradas e saídas
+	TArray<float> Heights;
+	TArray<float> Pitches;
+	TArray<float> Yaws;
+	TArray<float> Rolls;
+	TArray<uint8> Flags;
+
+	// Intermediário: 1 quando o item gira neste passo
+	TArray<float> SpinMask;
+};
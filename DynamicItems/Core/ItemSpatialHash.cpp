@@ -0,0 +1,98 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Structure: ItemSpatialHash
+
+#include "ItemSpatialHash.h"
+
+FItemSpatialHash::FItemSpatialHash(float InCellSize)
+	: InvCellSize(1.0f / FMath::Max(InCellSize, 1.0f))
+{
+}
+
+int32 FItemSpatialHash::Add(const FVector& Location, float Radius)
+{
+	FEntry NewEntry;
+	NewEntry.Location = Location;
+	NewEntry.Radius = Radius;
+	NewEntry.Cell = GetCell(Location);
+
+	const int32 Handle = Entries.Add(NewEntry);
+	AddToCell(Handle);
+	MaxRadius = FMath::Max(MaxRadius, Radius);
+	return Handle;
+}
+
+void FItemSpatialHash::Remove(int32 Handle)
+{
+	if (!IsValidHandle(Handle))
+	{
+		return;
+	}
+
+	RemoveFromCell(Handle);
+	Entries.RemoveAt(Handle);
+}
+
+void FItemSpatialHash::Move(int32 Handle, const FVector& Location)
+{
+	if (!IsValidHandle(Handle))
+	{
+		return;
+	}
+
+	FEntry& Entry = Entries[Handle];
+	Entry.Location = Location;
+
+	// Só trocar de célula quando realmente cruzar a borda
+	const FIntPoint NewCell = GetCell(Location);
+	if (NewCell != Entry.Cell)
+	{
+		RemoveFromCell(Handle);
+		Entry.Cell = NewCell;
+		AddToCell(Handle);
+	}
+}
+
+void FItemSpatialHash::SetRadius(int32 Handle, float Radius)
+{
+	if (IsValidHandle(Handle))
+	{
+		Entries[Handle].Radius = Radius;
+		MaxRadius = FMath::Max(MaxRadius, Radius);
+	}
+}
+
+void FItemSpatialHash::Reset()
+{
+	Entries.Reset();
+	Cells.Reset();
+	MaxRadius = 0.0f;
+}
+
+void FItemSpatialHash::AddToCell(int32 Handle)
+{
+	FEntry& Entry = Entries[Handle];
+	TArray<int32>& CellHandles = Cells.FindOrAdd(Entry.Cell);
+	Entry.SlotInCell = CellHandles.Add(Handle);
+}
+
+void FItemSpatialHash::RemoveFromCell(int32 Handle)
+{
+	FEntry& Entry = Entries[Handle];
+	TArray<int32>* CellHandles = Cells.Find(Entry.Cell);
+	if (!CellHandles || !CellHandles->IsValidIndex(Entry.SlotInCell))
+	{
+		return;
+	}
+
+	// Remoção com swap, corrigindo o slot da entrada movida
+	CellHandles->RemoveAtSwap(Entry.SlotInCell, 1, false);
+	if (CellHandles->IsValidIndex(Entry.SlotInCell))
+	{
+		Entries[(*CellHandles)[Entry.SlotInCell]].SlotInCell = Entry.SlotInCell;
+	}
+	Entry.SlotInCell = INDEX_NONE;
+
+	if (CellHandles->Num() == 0)
+	{
+		Cells.Remove(Entry.Cell);
+	}
+}
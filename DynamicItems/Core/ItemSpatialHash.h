@@ -0,0 +1,101 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Structure: ItemSpatialHash
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Grade uniforme 2D (XY) de posições de itens
+ * Cada entrada pode ter um raio próprio (alcance de interação); as consultas usam distância 3D
+ */
+class ANDROMEDA_API FItemSpatialHash
+{
+public:
+	explicit FItemSpatialHash(float InCellSize = 400.0f);
+
+	// Retorna um handle estável enquanto a entrada existir
+	int32 Add(const FVector& Location, float Radius = 0.0f);
+	void Remove(int32 Handle);
+	void Move(int32 Handle, const FVector& Location);
+	void SetRadius(int32 Handle, float Radius);
+	void Reset();
+
+	FORCEINLINE bool IsValidHandle(int32 Handle) const { return Entries.IsValidIndex(Handle); }
+	FORCEINLINE const FVector& GetLocation(int32 Handle) const { return Entries[Handle].Location; }
+	FORCEINLINE float GetRadius(int32 Handle) const { return Entries[Handle].Radius; }
+	FORCEINLINE int32 Num() const { return Entries.Num(); }
+
+	// Chama Func(Handle) para cada entrada a até Radius de Center
+	template<typename FuncType>
+	void ForEachInRadius(const FVector& Center, float Radius, FuncType&& Func) const
+	{
+		const float RadiusSquared = Radius * Radius;
+		ForEachCellInRange(Center, Radius, [this, &Center, RadiusSquared, &Func](const TArray<int32>& CellHandles)
+		{
+			for (int32 Handle : CellHandles)
+			{
+				if (FVector::DistSquared(Entries[Handle].Location, Center) <= RadiusSquared)
+				{
+					Func(Handle);
+				}
+			}
+		});
+	}
+
+	// Chama Func(Handle) para cada entrada cujo próprio raio alcança Point
+	template<typename FuncType>
+	void ForEachCovering(const FVector& Point, FuncType&& Func) const
+	{
+		ForEachCellInRange(Point, MaxRadius, [this, &Point, &Func](const TArray<int32>& CellHandles)
+		{
+			for (int32 Handle : CellHandles)
+			{
+				const FEntry& Entry = Entries[Handle];
+				if (FVector::DistSquared(Entry.Location, Point) <= FMath::Square(Entry.Radius))
+				{
+					Func(Handle);
+				}
+			}
+		});
+	}
+
+private:
+	struct FEntry
+	{
+		FVector Location = FVector::ZeroVector;
+		float Radius = 0.0f;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+		int32 SlotInCell = INDEX_NONE;
+	};
+
+	FORCEINLINE FIntPoint GetCell(const FVector& Location) const
+	{
+		return FIntPoint(FMath::FloorToInt(Location.X * InvCellSize), FMath::FloorToInt(Location.Y * InvCellSize));
+	}
+
+	template<typename FuncType>
+	void ForEachCellInRange(const FVector& Center, float Radius, FuncType&& Func) const
+	{
+		const FIntPoint MinCell = GetCell(Center - FVector(Radius, Radius, 0.0f));
+		const FIntPoint MaxCell = GetCell(Center + FVector(Radius, Radius, 0.0f));
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+		{
+			for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+			{
+				if (const TArray<int32>* CellHandles = Cells.Find(FIntPoint(CellX, CellY)))
+				{
+					Func(*CellHandles);
+				}
+			}
+		}
+	}
+
+	void AddToCell(int32 Handle);
+	void RemoveFromCell(int32 Handle);
+
+	float InvCellSize;
+	float MaxRadius = 0.0f; // Maior raio já registrado (nunca diminui)
+
+	TSparseArray<FEntry> Entries;
+	TMap<FIntPoint, TArray<int32>> Cells;
+};
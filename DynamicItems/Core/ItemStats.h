@@ -0,0 +1,9 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Stats: DynamicItems
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+// Grupo de stats do sistema de itens (use "stat AndromedaItems" no console)
+DECLARE_STATS_GROUP(TEXT("AndromedaItems"), STATGROUP_AndromedaItems, STATCAT_Advanced);
@@ -0,0 +1,142 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Structure: ItemTimingWheel
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Timing wheel de uma camada para vencimentos compartilhados (ex: cooldowns de overlap de todos os itens)
+ * Cada slot cobre SlotDuration segundos; prazos além de uma volta guardam o número de voltas restantes
+ * Agendar e cancelar são O(1); Advance só visita os slots que passaram desde a última chamada
+ * Um vencimento dispara uma única vez, com atraso de no máximo um slot
+ */
+template<typename PayloadType>
+class TItemTimingWheel
+{
+public:
+	explicit TItemTimingWheel(float InSlotDuration = 0.1f, int32 InNumSlots = 256)
+		: InvSlotDuration(1.0f / FMath::Max(InSlotDuration, KINDA_SMALL_NUMBER))
+	{
+		SlotHeads.Init(INDEX_NONE, FMath::Max(InNumSlots, 1));
+	}
+
+	// Agenda Payload para o tempo absoluto ExpireTime; retorna um handle válido até vencer ou ser cancelado
+	int32 Schedule(double ExpireTime, PayloadType Payload)
+	{
+		const int64 ExpireTick = FMath::Max(CurrentTick + 1, static_cast<int64>(FMath::CeilToDouble(ExpireTime * InvSlotDuration)));
+		const int64 TicksAhead = ExpireTick - CurrentTick;
+
+		FEntry NewEntry;
+		NewEntry.Payload = MoveTemp(Payload);
+		NewEntry.Slot = static_cast<int32>(ExpireTick % SlotHeads.Num());
+		NewEntry.Rounds = static_cast<int32>((TicksAhead - 1) / SlotHeads.Num());
+
+		const int32 Handle = Entries.Add(MoveTemp(NewEntry));
+		Link(Handle);
+		return Handle;
+	}
+
+	void Cancel(int32 Handle)
+	{
+		if (IsValidHandle(Handle))
+		{
+			Unlink(Handle);
+			Entries.RemoveAt(Handle);
+		}
+	}
+
+	// Descarta todos os vencimentos e reposiciona a roda em Time
+	void Reset(double Time)
+	{
+		Entries.Reset();
+		SlotHeads.Init(INDEX_NONE, SlotHeads.Num());
+		CurrentTick = static_cast<int64>(FMath::FloorToDouble(Time * InvSlotDuration));
+	}
+
+	// Avança até Time chamando Func(Payload) para cada vencimento
+	// O handle já foi liberado quando Func é chamada; Func não deve agendar nem cancelar nesta roda
+	template<typename FuncType>
+	void Advance(double Time, FuncType&& Func)
+	{
+		const int64 TargetTick = static_cast<int64>(FMath::FloorToDouble(Time * InvSlotDuration));
+		if (Entries.Num() == 0)
+		{
+			CurrentTick = FMath::Max(CurrentTick, TargetTick);
+			return;
+		}
+
+		while (CurrentTick < TargetTick && Entries.Num() > 0)
+		{
+			++CurrentTick;
+			int32 Handle = SlotHeads[static_cast<int32>(CurrentTick % SlotHeads.Num())];
+			while (Handle != INDEX_NONE)
+			{
+				FEntry& Entry = Entries[Handle];
+				const int32 NextHandle = Entry.Next;
+				if (Entry.Rounds > 0)
+				{
+					--Entry.Rounds;
+				}
+				else
+				{
+					PayloadType Payload = MoveTemp(Entry.Payload);
+					Unlink(Handle);
+					Entries.RemoveAt(Handle);
+					Func(MoveTemp(Payload));
+				}
+				Handle = NextHandle;
+			}
+		}
+		CurrentTick = FMath::Max(CurrentTick, TargetTick);
+	}
+
+	FORCEINLINE bool IsValidHandle(int32 Handle) const { return Entries.IsValidIndex(Handle); }
+	FORCEINLINE const PayloadType& Get(int32 Handle) const { return Entries[Handle].Payload; }
+	FORCEINLINE int32 Num() const { return Entries.Num(); }
+
+private:
+	struct FEntry
+	{
+		PayloadType Payload;
+		int32 Slot = INDEX_NONE;
+		int32 Rounds = 0; // Voltas completas que ainda faltam
+		int32 Prev = INDEX_NONE;
+		int32 Next = INDEX_NONE;
+	};
+
+	// Lista duplamente encadeada por slot, para cancelar em O(1)
+	void Link(int32 Handle)
+	{
+		FEntry& Entry = Entries[Handle];
+		Entry.Prev = INDEX_NONE;
+		Entry.Next = SlotHeads[Entry.Slot];
+		if (Entry.Next != INDEX_NONE)
+		{
+			Entries[Entry.Next].Prev = Handle;
+		}
+		SlotHeads[Entry.Slot] = Handle;
+	}
+
+	void Unlink(int32 Handle)
+	{
+		const FEntry& Entry = Entries[Handle];
+		if (Entry.Prev != INDEX_NONE)
+		{
+			Entries[Entry.Prev].Next = Entry.Next;
+		}
+		else
+		{
+			SlotHeads[Entry.Slot] = Entry.Next;
+		}
+		if (Entry.Next != INDEX_NONE)
+		{
+			Entries[Entry.Next].Prev = Entry.Prev;
+		}
+	}
+
+	float InvSlotDuration;
+	int64 CurrentTick = 0;
+
+	TSparseArray<FEntry> Entries;
+	TArray<int32> SlotHeads;
+};
@@ -1,11 +1,27 @@
-// Dynamic item system // Version 1.0.0 // date: 2026-01-29 // last update: 2026-01-29 // Author: Pilha-DS // Actor: MasterItem
+// Dynamic item system // Version 1.0.0 // date: 2026-01-29 // last update: 2026-10-16 // Author: Pilha-DS // Actor: MasterItem
 
 #include "MasterItem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/ItemStats.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemManagerSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemMeshLoaderSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemDefinitionRegistry.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemInstancedRenderSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemProximitySubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemRegistrySubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemWidgetSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemLightSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemCooldownSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemPhysicsSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemStackMergeSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemWorldListSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemPoolSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemPersistenceSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Networking/ItemPickupComponent.h"
+#include "AndromedaSystemsC/DynamicItems/Data/ItemDefinition.h"
+#include "AndromedaSystemsC/DynamicItems/Diagnostics/ItemTrace.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/SkeletalMeshComponent.h"
-#include "Components/SphereComponent.h"
 #include "Components/SpotLightComponent.h"
-#include "Components/WidgetComponent.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/SkeletalMesh.h"
 #include "GameFramework/Character.h"
@@ -13,128 +29,423 @@
 #include "Camera/CameraComponent.h"
 #include "UObject/ConstructorHelpers.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Components/SceneComponent.h"
+#include "TimerManager.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("MasterItem Actor Tick"), STAT_MasterItemActorTick, STATGROUP_AndromedaItems);
+DECLARE_CYCLE_STAT(TEXT("MasterItem SetupMesh"), STAT_MasterItemSetupMesh, STATGROUP_AndromedaItems);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Net Dormant Items"), STAT_MasterItemNetDormant, STATGROUP_AndromedaItems);
+DECLARE_CYCLE_STAT(TEXT("MasterItem Hover Update"), STAT_MasterItemHoverUpdate, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hover Root Moves"), STAT_MasterItemHoverRootMoves, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hover Visual Moves"), STAT_MasterItemHoverVisualMoves, STATGROUP_AndromedaItems);
+
+static TAutoConsoleVariable<bool> CVarItemCosmeticHover(
+	TEXT("andromeda.Items.CosmeticHover"),
+	true,
+	TEXT("Se verdadeiro, flutuação e rotação movem apenas um proxy visual sem colisão; root, física e movimento replicado ficam parados.\n")
+	TEXT("Se falso, o root do item é movido a cada frame (apenas para comparação de custo com Andromeda.Items.Benchmark)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarItemPickupTolerance(
+	TEXT("andromeda.Items.PickupTolerance"),
+	150.0f,
+	TEXT("Distância extra além do raio de interação aceita pelo servidor ao validar um pickup."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarItemNetDormancy(
+	TEXT("andromeda.Items.NetDormancy"),
+	true,
+	TEXT("Se verdadeiro, itens assentados entram em dormência de rede (DORM_DormantAll) no servidor.\n")
+	TEXT("Se falso, continuam sendo avaliados a cada atualização de rede (apenas para comparação de custo)."),
+	ECVF_Default);
+
+// Interpolação exponencial: um passo de 2*dt dá o mesmo resultado que dois passos de dt
+// Necessária porque itens de baixa significância atualizam com intervalos variáveis (UItemManagerSubsystem)
+// Para dt pequeno equivale a FMath::FInterpTo/VInterpTo/RInterpTo
+static float GetItemInterpAlpha(float DeltaTime, float InterpSpeed)
+{
+	return InterpSpeed <= 0.0f ? 1.0f : 1.0f - FMath::Exp(-InterpSpeed * DeltaTime);
+}
+
+template<typename T>
+static T ItemInterpTo(const T& Current, const T& Target, float DeltaTime, float InterpSpeed)
+{
+	return FMath::Lerp(Current, Target, GetItemInterpAlpha(DeltaTime, InterpSpeed));
+}
+
+static FRotator ItemRInterpTo(const FRotator& Current, const FRotator& Target, float DeltaTime, float InterpSpeed)
+{
+	return (Current + (Target - Current).GetNormalized() * GetItemInterpAlpha(DeltaTime, InterpSpeed)).GetNormalized();
+}
+
+// Corpo físico do item (root): física ligada, bloqueia o mundo, ignora a câmera
+// Proximidade de players é resolvida pelo UItemProximitySubsystem, sem eventos de overlap
+static void ConfigureItemBody(UPrimitiveComponent* Body)
+{
+	Body->SetSimulatePhysics(true);
+	Body->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	Body->SetCollisionObjectType(ECollisionChannel::ECC_WorldDynamic);
+	Body->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Block);
+	Body->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Overlap);
+	Body->SetCollisionResponseToChannel(ECollisionChannel::ECC_Camera, ECollisionResponse::ECR_Ignore);
+	Body->SetGenerateOverlapEvents(false);
+}
 
 AMasterItem::AMasterItem(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
+	// Os itens são atualizados em lote pelo UItemManagerSubsystem
+	// O Tick do ator só é ligado no caminho legado (andromeda.Items.BatchedTick = 0)
 	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 	bReplicates = true;
 	SetReplicateMovement(true);
+	// Acordado enquanto cai; entra em DORM_DormantAll quando assentar (CheckSettled)
+	NetDormancy = DORM_Awake;
 
-	// Criar StaticMeshComponent
+	// Criar StaticMeshComponent: root de itens estáticos e do placeholder durante o carregamento
+	// Itens esqueléticos trocam para um SkeletalMeshComponent criado sob demanda quando o mesh chega
 	StaticMeshComponent = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("StaticMeshComponent"));
 	RootComponent = StaticMeshComponent;
-	StaticMeshComponent->SetSimulatePhysics(true);
-	StaticMeshComponent->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-	StaticMeshComponent->SetCollisionObjectType(ECollisionChannel::ECC_WorldDynamic);
-	StaticMeshComponent->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Block);
-	StaticMeshComponent->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Overlap);
-	StaticMeshComponent->SetCollisionResponseToChannel(ECollisionChannel::ECC_Camera, ECollisionResponse::ECR_Ignore);
-
-	// Criar SkeletalMeshComponent (inicialmente desabilitado)
-	SkeletalMeshComponent = CreateDefaultSubobject<USkeletalMeshComponent>(TEXT("SkeletalMeshComponent"));
-	SkeletalMeshComponent->SetupAttachment(RootComponent);
-	SkeletalMeshComponent->SetSimulatePhysics(true);
-	SkeletalMeshComponent->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-	SkeletalMeshComponent->SetCollisionObjectType(ECollisionChannel::ECC_WorldDynamic);
-	SkeletalMeshComponent->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Block);
-	SkeletalMeshComponent->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Overlap);
-	SkeletalMeshComponent->SetCollisionResponseToChannel(ECollisionChannel::ECC_Camera, ECollisionResponse::ECR_Ignore);
-	SkeletalMeshComponent->SetVisibility(false);
-	SkeletalMeshComponent->SetActive(false);
-
-	// Criar CollisionSphere
-	CollisionSphere = CreateDefaultSubobject<USphereComponent>(TEXT("CollisionSphere"));
-	CollisionSphere->SetupAttachment(RootComponent);
-	CollisionSphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-	CollisionSphere->SetCollisionObjectType(ECollisionChannel::ECC_WorldDynamic);
-	CollisionSphere->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Ignore);
-	CollisionSphere->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Overlap);
-	CollisionSphere->SetSphereRadius(50.0f);
-
-	// Criar SpotLight
-	SpotLight = CreateDefaultSubobject<USpotLightComponent>(TEXT("SpotLight"));
-	SpotLight->SetupAttachment(RootComponent);
-	SpotLight->SetRelativeRotation(FRotator(-90.0f, 0.0f, 0.0f));
-	SpotLight->SetIntensity(LightSettings.Intensity);
-	SpotLight->SetAttenuationRadius(LightSettings.AttenuationRadius);
-	SpotLight->SetVisibility(false);
-
-	// Criar WidgetComponents
-	WidgetInstructionComponent = CreateDefaultSubobject<UWidgetComponent>(TEXT("WidgetInstructionComponent"));
-	// WidgetInstruction não é anexado ao RootComponent, tem posição independente
-	WidgetInstructionComponent->SetWidgetSpace(EWidgetSpace::Screen);
-	WidgetInstructionComponent->SetVisibility(false);
-	// Garantir que não está anexado a nenhum componente
-	WidgetInstructionComponent->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
-
-	WidgetPickupComponent = CreateDefaultSubobject<UWidgetComponent>(TEXT("WidgetPickupComponent"));
-	WidgetPickupComponent->SetupAttachment(RootComponent);
-	WidgetPickupComponent->SetWidgetSpace(EWidgetSpace::Screen);
-	WidgetPickupComponent->SetVisibility(false);
+	ConfigureItemBody(StaticMeshComponent);
+
+	// Placeholder exibido enquanto o mesh real é carregado
+	static ConstructorHelpers::FObjectFinder<UStaticMesh> PlaceholderMeshFinder(TEXT("/Engine/BasicShapes/Sphere.Sphere"));
+	if (PlaceholderMeshFinder.Succeeded())
+	{
+		PlaceholderMesh = PlaceholderMeshFinder.Object;
+	}
+
+	// SpotLight é criado sob demanda (GetOrCreateSpotLight), apenas para itens dentro do orçamento de luzes
 }
 
 void AMasterItem::BeginPlay()
 {
 	Super::BeginPlay();
 
-	ValidateItemData();
+	// Item colocado no nível longe dos players (ou já adotado antes): vira registro sem pagar o setup
+	if (UItemPersistenceSubsystem* Persistence = GetWorld()->GetSubsystem<UItemPersistenceSubsystem>())
+	{
+		if (Persistence->AdoptPlacedItem(this))
+		{
+			return;
+		}
+	}
+
+	// Definição inválida: o item já foi destruído (servidor) ou desativado (cliente)
+	if (!ValidateItemData() || !Definition)
+	{
+		return;
+	}
 
 	// Configurar componentes baseado nos dados do item
-	SetupMesh();
+	// SetupMesh é assíncrono: raio de interação e luz são finalizados em ApplyLoadedMesh
 	SetupCollision();
-	SetupCollisionSphere();
-	SetupLight();
-	SetupWidgets();
+	SetupInteractionRange();
+	SetupMesh();
+
+	ActivateItem();
+
+	// Manter a posição nos spatial hashes de proximidade e do registro
+	// Componentes de mesh criados depois (SetMeshRoot) fazem o próprio bind
+	if (StaticMeshComponent)
+	{
+		StaticMeshComponent->TransformUpdated.AddUObject(this, &AMasterItem::OnRootTransformUpdated);
+	}
+}
+
+void AMasterItem::ActivateItem()
+{
+	// Registrar no ItemManager, que passa a cuidar do estado de floating, rotação e luz
+	ItemManager = GetWorld()->GetSubsystem<UItemManagerSubsystem>();
+	if (ItemManager)
+	{
+		ItemManager->RegisterItem(this);
+	}
+
+	// Registrar no spatial hash de proximidade com o raio já calculado
+	Proximity = GetWorld()->GetSubsystem<UItemProximitySubsystem>();
+	if (Proximity && ProximityHandle == INDEX_NONE)
+	{
+		ProximityHandle = Proximity->RegisterItem(this, InteractionRadius);
+		Proximity->SetItemDebugDraw(ProximityHandle, Definition->CollisionSphereSettings.ShowOverlappingArea);
+	}
+
+	ItemRegistry = GetWorld()->GetSubsystem<UItemRegistrySubsystem>();
+	if (ItemRegistry && ItemRegistryHandle == INDEX_NONE)
+	{
+		ItemRegistryHandle = ItemRegistry->RegisterItem(this);
+	}
+
+	Cooldowns = GetWorld()->GetSubsystem<UItemCooldownSubsystem>();
+	WorldList = GetWorld()->GetSubsystem<UItemWorldListSubsystem>();
+	Physics = GetWorld()->GetSubsystem<UItemPhysicsSubsystem>();
+	if (const UPrimitiveComponent* Body = Cast<UPrimitiveComponent>(RootComponent))
+	{
+		// Também itens acordados (EasyMode): o root fica parado no modo cosmético e pode assentar
+		if (Physics && Body->IsSimulatingPhysics())
+		{
+			Physics->TrackItem(this);
+		}
+	}
 
 	// Salvar posição e rotação originais
-	OriginalLocation = GetActorLocation();
-	OriginalRotation = GetActorRotation();
-	CurrentRotation = OriginalRotation;
-	
+	if (FItemRuntimeState* State = ItemManager ? ItemManager->GetRuntimeState(this) : nullptr)
+	{
+		State->OriginalLocation = GetActorLocation();
+		State->OriginalRotation = GetActorRotation();
+		State->CurrentRotation = State->OriginalRotation;
+	}
+
+	// Drop fora da área carregada (ex: servidor longe dos players) é desidratado no próximo Tick da persistência
+	if (UItemPersistenceSubsystem* Persistence = GetWorld()->GetSubsystem<UItemPersistenceSubsystem>())
+	{
+		Persistence->NotifyItemActivated(this);
+	}
+
+	// O item nasce dormindo; EasyMode precisa de atualização contínua (exceto no perfil de servidor, sem efeitos)
+	if (ItemManager && bEasyMode && !UItemManagerSubsystem::IsServerProfileActive(GetWorld()))
+	{
+		ItemManager->WakeItem(this);
+	}
+	else
+	{
+		OnFellAsleep();
+	}
+
 	// Salvar posição fixa do WidgetInstruction no mundo
-	WidgetInstructionWorldLocation = GetActorLocation() + WidgetsSettings.WidgetInstructionPosition;
+	WidgetInstructionWorldLocation = GetActorLocation() + Definition->WidgetsSettings.WidgetInstructionPosition;
+}
+
+void AMasterItem::DeactivateForPool()
+{
+	PromoteFromInstance();
+	EndVisualHover();
+
+	if (UItemWidgetSubsystem* ItemWidgets = GetWorld()->GetSubsystem<UItemWidgetSubsystem>())
+	{
+		ItemWidgets->ClearFocusedItem(this);
+	}
+	ReleaseLight();
+	bIsInPool = true;
+
+	// O mesh pendente pode chegar com o ator já reaproveitado; ActivateFromPool pede de novo (bMeshLoadPending continua)
+	if (bMeshLoadPending)
+	{
+		if (UItemMeshLoaderSubsystem* MeshLoader = GetWorld()->GetSubsystem<UItemMeshLoaderSubsystem>())
+		{
+			MeshLoader->CancelRequest(this);
+		}
+	}
+
+	if (ItemManager)
+	{
+		ItemManager->UnregisterItem(this);
+	}
+	if (Proximity)
+	{
+		Proximity->UnregisterItem(ProximityHandle);
+		ProximityHandle = INDEX_NONE;
+	}
+	if (ItemRegistry)
+	{
+		ItemRegistry->UnregisterItem(ItemRegistryHandle);
+		ItemRegistryHandle = INDEX_NONE;
+	}
+	if (Cooldowns)
+	{
+		Cooldowns->ClearItemCooldowns(this);
+	}
+	if (Physics)
+	{
+		Physics->UntrackItem(this);
+	}
+	GetWorldTimerManager().ClearAllTimersForObject(this);
+	OverlappingPlayers.Reset();
+
+	// Sem física, escondido e com componentes desregistrados: custo zero enquanto estiver no pool
+	if (StaticMeshComponent)
+	{
+		StaticMeshComponent->SetSimulatePhysics(false);
+	}
+	if (SkeletalMeshComponent)
+	{
+		SkeletalMeshComponent->SetSimulatePhysics(false);
+	}
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	UnregisterAllComponents();
+
+	// Em jogo em rede o ator sai dos clientes enquanto estiver no pool
+	if (WorldList)
+	{
+		WorldList->RemoveItem(this);
+	}
+	if (HasAuthority() && GetNetMode() != NM_Standalone)
+	{
+		SetNetDormant(false);
+		SetReplicates(false);
+	}
+}
+
+void AMasterItem::ActivateFromPool(UItemDefinition* InDefinition, int32 InQuantity, const FTransform& SpawnTransform)
+{
+	bIsInPool = false;
+	bPickupPredicted = false;
+
+	const bool bSameDefinition = Definition == InDefinition;
+	InitializeItem(InDefinition, InQuantity);
+
+	RegisterAllComponents();
+	SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+
+	if (HasAuthority() && GetNetMode() != NM_Standalone)
+	{
+		SetReplicates(true);
+	}
+
+	if (!ValidateItemData() || !Definition)
+	{
+		return;
+	}
+
+	// Mesma definição com o mesh já aplicado: mesh, luz e widgets continuam configurados
+	if (!bSameDefinition || bMeshLoadPending)
+	{
+		SetupInteractionRange();
+		SetupMesh();
+	}
+
+	// DeactivateForPool desligou a simulação e SetMeshRoot herda esse estado: religar depois da reconfiguração
+	bPhysicsResting = false;
+	UItemPhysicsSubsystem::SetBodySimulating(Cast<UPrimitiveComponent>(RootComponent), true);
+
+	ActivateItem();
+}
+
+void AMasterItem::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Célula do World Partition / sublevel descarregando: o estado do item colocado vira registro
+	if (EndPlayReason == EEndPlayReason::RemovedFromWorld)
+	{
+		if (UItemPersistenceSubsystem* Persistence = GetWorld()->GetSubsystem<UItemPersistenceSubsystem>())
+		{
+			Persistence->OnPlacedItemRemoved(this);
+		}
+	}
+
+	PromoteFromInstance();
+
+	if (UItemWidgetSubsystem* ItemWidgets = GetWorld()->GetSubsystem<UItemWidgetSubsystem>())
+	{
+		ItemWidgets->ClearFocusedItem(this);
+	}
+	ReleaseLight();
+
+	if (NetDormancy == DORM_DormantAll)
+	{
+		DEC_DWORD_STAT(STAT_MasterItemNetDormant);
+	}
+
+	if (ItemManager)
+	{
+		ItemManager->UnregisterItem(this);
+		ItemManager = nullptr;
+	}
+
+	if (Proximity)
+	{
+		Proximity->UnregisterItem(ProximityHandle);
+		ProximityHandle = INDEX_NONE;
+		Proximity = nullptr;
+	}
+
+	if (ItemRegistry)
+	{
+		ItemRegistry->UnregisterItem(ItemRegistryHandle);
+		ItemRegistryHandle = INDEX_NONE;
+		ItemRegistry = nullptr;
+	}
+
+	// Cooldowns pendentes deste item vencem sozinhos (referência fraca)
+	Cooldowns = nullptr;
+
+	if (WorldList)
+	{
+		WorldList->RemoveItem(this);
+		WorldList = nullptr;
+	}
 
-	// Configurar eventos de overlap
-	if (CollisionSphere)
+	if (Physics)
 	{
-		CollisionSphere->OnComponentBeginOverlap.AddDynamic(this, &AMasterItem::OnCollisionSphereBeginOverlap);
-		CollisionSphere->OnComponentEndOverlap.AddDynamic(this, &AMasterItem::OnCollisionSphereEndOverlap);
+		Physics->UntrackItem(this);
+		Physics = nullptr;
 	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AMasterItem::PostNetReceiveLocationAndRotation()
+{
+	PromoteFromInstance();
+
+	Super::PostNetReceiveLocationAndRotation();
 }
 
 void AMasterItem::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
-	// Remover players inválidos da lista (caso tenham sido destruídos)
+	SCOPE_CYCLE_COUNTER(STAT_MasterItemActorTick);
+
+	// Caminho legado (andromeda.Items.BatchedTick 0), no formato do Tick original por ator para comparação:
+	// todo item registrado roda todo frame, sem dormência, significância nem kernel, e refaz o trabalho por frame
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
 	OverlappingPlayers.RemoveAll([](ACharacter* Player) { return !IsValid(Player); });
-	
-	// Limpar cooldowns expirados e players inválidos do mapa de cooldowns
-	float CurrentTime = GetWorld()->GetTimeSeconds();
-	TArray<ACharacter*> PlayersToRemove;
-	for (auto& CooldownPair : PlayerCooldowns)
+
+	if (FItemRuntimeState* State = ItemManager ? ItemManager->GetRuntimeState(this) : nullptr)
 	{
-		if (!IsValid(CooldownPair.Key) || (CurrentTime - CooldownPair.Value) >= OverlapCooldownTime)
+		UpdateItem(DeltaTime, *State);
+	}
+
+	// Widgets reavaliados a cada frame, como o UpdateWidgets original
+	if (OverlappingPlayers.ContainsByPredicate([](const ACharacter* Player) { return Player->IsLocallyControlled(); }))
+	{
+		if (UItemWidgetSubsystem* ItemWidgets = GetWorld()->GetSubsystem<UItemWidgetSubsystem>())
 		{
-			PlayersToRemove.Add(CooldownPair.Key);
+			ItemWidgets->SetFocusedItem(this);
 		}
 	}
-	for (ACharacter* PlayerToRemove : PlayersToRemove)
+
+	if (ItemManager)
+	{
+		ItemManager->AddItemTickCycles(FPlatformTime::Cycles64() - StartCycles);
+	}
+}
+
+bool AMasterItem::UpdateItem(float DeltaTime, FItemRuntimeState& State)
+{
+	// Remover players inválidos da lista (caso tenham sido destruídos)
+	if (OverlappingPlayers.Num() > 0)
 	{
-		PlayerCooldowns.Remove(PlayerToRemove);
+		OverlappingPlayers.RemoveAll([](ACharacter* Player) { return !IsValid(Player); });
 	}
 
 	// Verificar se há pelo menos um player overlapping
 	bool bHasOverlappingPlayers = OverlappingPlayers.Num() > 0;
-	bool bEasyModeActive = BasicInfos.EasyMode;
 
-	// Manter WidgetInstruction em posição fixa no mundo (sempre, independente do estado)
-	if (WidgetInstructionComponent)
+	// Perfil de servidor dedicado: flutuação, rotação e luz são só dos clientes
+	// O item fica acordado (fora da dormência) apenas enquanto um player pode pegá-lo
+	if (UItemManagerSubsystem::IsServerProfileActive(GetWorld()))
 	{
-		WidgetInstructionComponent->SetWorldLocation(WidgetInstructionWorldLocation);
+		return bHasOverlappingPlayers;
 	}
+	bool bEasyModeActive = bEasyMode;
 
 	// Se EasyMode está ativo ou há players overlapping, ativar efeitos
 	if (bEasyModeActive || bHasOverlappingPlayers)
@@ -143,101 +454,174 @@ void AMasterItem::Tick(float DeltaTime)
 		if (bEasyModeActive && !bHasOverlappingPlayers)
 		{
 			// Inicializar estados apenas uma vez quando EasyMode é ativado
-			if (!bIsFloating)
+			if (!State.bIsFloating && !State.bUsingVisualProxy)
 			{
-				OriginalLocation = GetActorLocation();
-				OriginalRotation = GetActorRotation();
-				CurrentRotation = OriginalRotation;
-				bIsRotating = false;
-				bIsResettingRotation = false;
+				State.OriginalLocation = GetActorLocation();
+				State.OriginalRotation = GetActorRotation();
+				State.CurrentRotation = State.OriginalRotation;
+				State.bIsRotating = false;
+				State.bIsResettingRotation = false;
 				// Garantir que a luz seja ligada no EasyMode
-				bIsLightOn = false; // Resetar para forçar ativação
+				State.bIsLightOn = false; // Resetar para forçar ativação
 			}
 		}
 
-		UpdateFloating(DeltaTime);
-		UpdateRotation(DeltaTime);
-		UpdateLight();
-		
-		// Widgets só aparecem se houver players overlapping
-		UpdateWidgets();
+		{
+			SCOPE_CYCLE_COUNTER(STAT_MasterItemHoverUpdate);
+
+			const bool bAnimates = Definition->FloatingSettings.Floating || Definition->RotationSettings.Rotate;
+			if (bAnimates && !State.bUsingVisualProxy && !State.bIsFloating && !State.bIsRotating && CVarItemCosmeticHover.GetValueOnGameThread())
+			{
+				BeginVisualHover(State);
+			}
+
+			UpdateFloating(DeltaTime, State);
+			UpdateRotation(DeltaTime, State);
+
+			if (State.bUsingVisualProxy)
+			{
+				ApplyVisualTransform(State);
+			}
+		}
+		UpdateLight(State);
+
+		return true;
 	}
 	else
 	{
 		// Apenas parar de rotacionar, sem resetar
-		if (bIsRotating)
+		if (State.bIsRotating)
 		{
-			bIsRotating = false;
+			State.bIsRotating = false;
+			ITEM_TRACE(RotateStop, this, 0);
 		}
 
-		// Desativar floating e reativar física se necessário
-		if (bIsFloating)
+		// Modo cosmético: o proxy volta ao root antes de ser escondido, sem salto visual
+		bool bVisualAtRest = true;
+		if (State.bUsingVisualProxy)
 		{
-			bIsFloating = false;
-			// Reativar física imediatamente na posição atual
-			if (StaticMeshComponent && StaticMeshComponent->IsVisible())
+			if (State.bIsFloating)
 			{
-				StaticMeshComponent->SetSimulatePhysics(true);
+				State.bIsFloating = false;
+				ITEM_TRACE(FloatStop, this, 1);
 			}
-			if (SkeletalMeshComponent && SkeletalMeshComponent->IsVisible())
+			bVisualAtRest = ReturnVisualToRest(DeltaTime, State);
+			if (bVisualAtRest)
 			{
-				SkeletalMeshComponent->SetSimulatePhysics(true);
+				EndVisualHover();
+				State.bUsingVisualProxy = false;
 			}
 		}
-
-		// Desligar luz
-		if (bIsLightOn)
+		// Desativar floating e devolver o item à física (no lote do frame) para cair e assentar de novo
+		else if (State.bIsFloating)
 		{
-			bIsLightOn = false;
-			if (SpotLight)
+			State.bIsFloating = false;
+			ITEM_TRACE(FloatStop, this, 0);
+			ITEM_TRACE(PhysicsToggle, this, 1);
+			if (Physics)
+			{
+				Physics->RequestSimulation(this, true);
+			}
+			else
 			{
-				SpotLight->SetVisibility(false);
+				UItemPhysicsSubsystem::SetBodySimulating(Cast<UPrimitiveComponent>(RootComponent), true);
 			}
 		}
 
-		// Esconder widgets (UpdateWidgets já verifica o player local)
-		UpdateWidgets();
+		// Desligar luz
+		if (State.bIsLightOn)
+		{
+			State.bIsLightOn = false;
+			ReleaseLight();
+		}
+
+		// Efeitos desligados, física restaurada e proxy de volta ao root: o item pode dormir
+		return !bVisualAtRest;
 	}
 }
 
 void AMasterItem::SetupMesh()
 {
-	if (STModel.MeshType == EMeshType::Static)
+	SCOPE_CYCLE_COUNTER(STAT_MasterItemSetupMesh);
+
+	if (!Definition)
+	{
+		return;
+	}
+
+	FSoftObjectPath MeshPath = GetDefinitionMeshPath();
+	bMeshLoadPending = false;
+
+	// Mesh não configurado ou já em memória: aplicar imediatamente (ApplyLoadedMesh registra o aviso)
+	UObject* LoadedObject = MeshPath.ResolveObject();
+	if (MeshPath.IsNull() || LoadedObject)
+	{
+		ApplyLoadedMesh(LoadedObject);
+		return;
+	}
+
+	// Mostrar placeholder barato enquanto o mesh é carregado de forma assíncrona
+	ShowPlaceholderMesh();
+
+	if (UItemMeshLoaderSubsystem* MeshLoader = GetWorld()->GetSubsystem<UItemMeshLoaderSubsystem>())
+	{
+		ITEM_TRACE(MeshLoadStart, this, 0);
+		bMeshLoadPending = true;
+		MeshLoader->RequestMesh(MeshPath, Definition->STModel.MeshLoadPriority, this);
+	}
+}
+
+FSoftObjectPath AMasterItem::GetDefinitionMeshPath() const
+{
+	if (!Definition)
+	{
+		return FSoftObjectPath();
+	}
+	return Definition->STModel.MeshType == EMeshType::Static ? Definition->STModel.StaticMesh.ToSoftObjectPath() : Definition->STModel.SkeletalMesh.ToSoftObjectPath();
+}
+
+void AMasterItem::ShowPlaceholderMesh()
+{
+	if (!StaticMeshComponent || !PlaceholderMesh)
+	{
+		return;
+	}
+
+	StaticMeshComponent->SetStaticMesh(PlaceholderMesh);
+	StaticMeshComponent->SetWorldScale3D(Definition->STModel.Size * PlaceholderScale);
+	StaticMeshComponent->SetVisibility(true);
+	StaticMeshComponent->SetActive(true);
+}
+
+void AMasterItem::OnMeshLoaded(const FSoftObjectPath& MeshPath, UObject* LoadedObject)
+{
+	ITEM_TRACE(MeshLoadFinish, this, LoadedObject ? 1 : 0);
+
+	// Pedido antigo: o item voltou ao pool ou foi reaproveitado com outra definição enquanto carregava
+	if (IsActorBeingDestroyed() || bIsInPool || !bMeshLoadPending || MeshPath != GetDefinitionMeshPath())
+	{
+		return;
+	}
+
+	bMeshLoadPending = false;
+	ApplyLoadedMesh(LoadedObject);
+}
+
+void AMasterItem::ApplyLoadedMesh(UObject* LoadedObject)
+{
+	if (Definition->STModel.MeshType == EMeshType::Static)
 	{
 		// Verificar se o StaticMesh está configurado
-		if (!STModel.StaticMesh.IsNull())
+		if (!Definition->STModel.StaticMesh.IsNull())
 		{
-			UStaticMesh* LoadedMesh = STModel.StaticMesh.LoadSynchronous();
-			if (LoadedMesh && StaticMeshComponent)
+			UStaticMesh* LoadedMesh = Cast<UStaticMesh>(LoadedObject);
+			if (LoadedMesh)
 			{
-				StaticMeshComponent->SetStaticMesh(LoadedMesh);
-				StaticMeshComponent->SetWorldScale3D(STModel.Size);
-				StaticMeshComponent->SetVisibility(true);
-				StaticMeshComponent->SetActive(true);
-				
-				// Garantir que StaticMeshComponent seja o RootComponent
-				if (RootComponent != StaticMeshComponent)
-				{
-					// Reattachar componentes ao novo RootComponent
-					if (CollisionSphere)
-					{
-						CollisionSphere->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
-						CollisionSphere->SetupAttachment(StaticMeshComponent);
-					}
-					if (SpotLight)
-					{
-						SpotLight->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
-						SpotLight->SetupAttachment(StaticMeshComponent);
-					}
-					// WidgetInstruction não é anexado, mantém posição independente
-					if (WidgetPickupComponent)
-					{
-						WidgetPickupComponent->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
-						WidgetPickupComponent->SetupAttachment(StaticMeshComponent);
-					}
-					
-					RootComponent = StaticMeshComponent;
-				}
+				UStaticMeshComponent* Mesh = GetOrCreateStaticMeshComponent();
+				Mesh->SetStaticMesh(LoadedMesh);
+				Mesh->SetWorldScale3D(Definition->STModel.Size);
+				Mesh->SetVisibility(true);
+				Mesh->SetActive(true);
 			}
 			else
 			{
@@ -248,50 +632,21 @@ void AMasterItem::SetupMesh()
 		{
 			UE_LOG(LogTemp, Warning, TEXT("AMasterItem: StaticMesh não configurado para %s"), *GetName());
 		}
-		
-		// Desabilitar SkeletalMeshComponent
-		if (SkeletalMeshComponent)
-		{
-			SkeletalMeshComponent->SetVisibility(false);
-			SkeletalMeshComponent->SetActive(false);
-		}
 	}
-	else if (STModel.MeshType == EMeshType::Skeletal)
+	else if (Definition->STModel.MeshType == EMeshType::Skeletal)
 	{
 		// Verificar se o SkeletalMesh está configurado
-		if (!STModel.SkeletalMesh.IsNull())
+		if (!Definition->STModel.SkeletalMesh.IsNull())
 		{
-			USkeletalMesh* LoadedMesh = STModel.SkeletalMesh.LoadSynchronous();
-			if (LoadedMesh && SkeletalMeshComponent)
+			USkeletalMesh* LoadedMesh = Cast<USkeletalMesh>(LoadedObject);
+			if (LoadedMesh)
 			{
-				SkeletalMeshComponent->SetSkeletalMesh(LoadedMesh);
-				SkeletalMeshComponent->SetWorldScale3D(STModel.Size);
-				SkeletalMeshComponent->SetVisibility(true);
-				SkeletalMeshComponent->SetActive(true);
-				
-				// Garantir que SkeletalMeshComponent seja o RootComponent
-				if (RootComponent != SkeletalMeshComponent)
-				{
-					// Reattachar componentes ao novo RootComponent
-					if (CollisionSphere)
-					{
-						CollisionSphere->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
-						CollisionSphere->SetupAttachment(SkeletalMeshComponent);
-					}
-					if (SpotLight)
-					{
-						SpotLight->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
-						SpotLight->SetupAttachment(SkeletalMeshComponent);
-					}
-					// WidgetInstruction não é anexado, mantém posição independente
-					if (WidgetPickupComponent)
-					{
-						WidgetPickupComponent->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
-						WidgetPickupComponent->SetupAttachment(SkeletalMeshComponent);
-					}
-					
-					RootComponent = SkeletalMeshComponent;
-				}
+				// O placeholder estático é destruído na troca de root
+				USkeletalMeshComponent* Mesh = GetOrCreateSkeletalMeshComponent();
+				Mesh->SetSkeletalMesh(LoadedMesh);
+				Mesh->SetWorldScale3D(Definition->STModel.Size);
+				Mesh->SetVisibility(true);
+				Mesh->SetActive(true);
 			}
 			else
 			{
@@ -302,62 +657,152 @@ void AMasterItem::SetupMesh()
 		{
 			UE_LOG(LogTemp, Warning, TEXT("AMasterItem: SkeletalMesh não configurado para %s"), *GetName());
 		}
-		
-		// Desabilitar StaticMeshComponent
-		if (StaticMeshComponent)
-		{
-			StaticMeshComponent->SetVisibility(false);
-			StaticMeshComponent->SetActive(false);
-		}
+	}
+
+	// Dimensões e luz dependem do mesh final
+	UpdateInteractionRadius();
+	SetupLight();
+
+	// Mesh chegou com o item flutuando no modo cosmético: o proxy passa a exibir o mesh final
+	const FItemRuntimeState* State = ItemManager ? ItemManager->GetRuntimeState(this) : nullptr;
+	if (IsVisualProxyActive() || (State && State->bUsingVisualProxy))
+	{
+		SyncVisualProxy();
+	}
+
+	// Item que dormiu com o placeholder: agora pode assentar com o mesh final
+	if (ItemManager && ItemManagerIndex != INDEX_NONE && !ItemManager->IsItemAwake(this))
+	{
+		OnFellAsleep();
 	}
 }
 
-void AMasterItem::SetupCollision()
+UStaticMeshComponent* AMasterItem::GetOrCreateStaticMeshComponent()
 {
-	// Configuração já feita no construtor, mas podemos ajustar aqui se necessário
+	if (!StaticMeshComponent)
+	{
+		UStaticMeshComponent* Mesh = NewObject<UStaticMeshComponent>(this, MakeUniqueObjectName(this, UStaticMeshComponent::StaticClass(), TEXT("StaticMeshComponent")));
+		SetMeshRoot(Mesh);
+		StaticMeshComponent = Mesh;
+	}
+	return StaticMeshComponent;
 }
 
-void AMasterItem::SetupCollisionSphere()
+USkeletalMeshComponent* AMasterItem::GetOrCreateSkeletalMeshComponent()
 {
-	if (CollisionSphere)
+	if (!SkeletalMeshComponent)
 	{
-		UpdateCollisionSphereSize();
-		CollisionSphere->SetHiddenInGame(!CollisionSphereSettings.ShowOverlappingArea);
+		USkeletalMeshComponent* Mesh = NewObject<USkeletalMeshComponent>(this, MakeUniqueObjectName(this, USkeletalMeshComponent::StaticClass(), TEXT("SkeletalMeshComponent")));
+		SetMeshRoot(Mesh);
+		SkeletalMeshComponent = Mesh;
 	}
+	return SkeletalMeshComponent;
 }
 
-void AMasterItem::UpdateCollisionSphereSize()
+void AMasterItem::SetMeshRoot(UPrimitiveComponent* NewRoot)
 {
-	if (!CollisionSphere) return;
+	UPrimitiveComponent* OldRoot = Cast<UPrimitiveComponent>(RootComponent);
+	if (!NewRoot || NewRoot == OldRoot)
+	{
+		return;
+	}
 
-	FVector MeshBounds = FVector::ZeroVector;
-	
-	if (StaticMeshComponent && StaticMeshComponent->IsVisible() && StaticMeshComponent->GetStaticMesh())
+	// O novo corpo nasce onde o antigo estava e herda o estado da física
+	ConfigureItemBody(NewRoot);
+	if (OldRoot)
 	{
-		FBoxSphereBounds Bounds = StaticMeshComponent->GetStaticMesh()->GetBounds();
-		MeshBounds = Bounds.BoxExtent * 2.0f * STModel.Size;
+		NewRoot->SetWorldLocationAndRotation(OldRoot->GetComponentLocation(), OldRoot->GetComponentQuat());
+		NewRoot->SetSimulatePhysics(OldRoot->IsSimulatingPhysics());
+		NewRoot->SetCollisionEnabled(OldRoot->GetCollisionEnabled());
 	}
-	else if (SkeletalMeshComponent && SkeletalMeshComponent->IsVisible() && SkeletalMeshComponent->GetSkeletalMeshAsset())
+	SetRootComponent(NewRoot);
+	NewRoot->RegisterComponent();
+	NewRoot->TransformUpdated.AddUObject(this, &AMasterItem::OnRootTransformUpdated);
+
+	if (!OldRoot)
 	{
-		FBoxSphereBounds Bounds = SkeletalMeshComponent->GetSkeletalMeshAsset()->GetBounds();
-		MeshBounds = Bounds.BoxExtent * 2.0f * STModel.Size;
+		return;
 	}
 
-	float MaxDimension = FMath::Max3(MeshBounds.X, MeshBounds.Y, MeshBounds.Z);
-	float SphereRadius;
-	
-	// Se o mesh for menor que o tamanho mínimo, usar o tamanho mínimo
-	// Caso contrário, usar o dobro do tamanho do mesh
-	if (MaxDimension < CollisionSphereSettings.MinimumSize)
+	if (OldRoot->IsSimulatingPhysics())
 	{
-		SphereRadius = CollisionSphereSettings.MinimumSize;
+		NewRoot->SetPhysicsLinearVelocity(OldRoot->GetPhysicsLinearVelocity());
+	}
+
+	// Luz e proxies visuais seguem o novo root; o mesh antigo não é mais necessário
+	const TArray<TObjectPtr<USceneComponent>> Children = OldRoot->GetAttachChildren();
+	for (USceneComponent* Child : Children)
+	{
+		if (Child)
+		{
+			Child->AttachToComponent(NewRoot, FAttachmentTransformRules::KeepWorldTransform);
+		}
+	}
+
+	if (OldRoot == StaticMeshComponent)
+	{
+		StaticMeshComponent = nullptr;
+	}
+	else if (OldRoot == SkeletalMeshComponent)
+	{
+		SkeletalMeshComponent = nullptr;
+	}
+	OldRoot->TransformUpdated.RemoveAll(this);
+	OldRoot->DestroyComponent();
+}
+
+void AMasterItem::SetupCollision()
+{
+	// Configuração já feita no construtor, mas podemos ajustar aqui se necessário
+}
+
+void AMasterItem::SetupInteractionRange()
+{
+	if (!Definition)
+	{
+		return;
+	}
+
+	UpdateInteractionRadius();
+
+	if (Proximity)
+	{
+		Proximity->SetItemDebugDraw(ProximityHandle, Definition->CollisionSphereSettings.ShowOverlappingArea);
+	}
+}
+
+void AMasterItem::UpdateInteractionRadius()
+{
+	FVector MeshBounds = FVector::ZeroVector;
+
+	if (StaticMeshComponent && StaticMeshComponent->IsVisible() && StaticMeshComponent->GetStaticMesh())
+	{
+		FBoxSphereBounds Bounds = StaticMeshComponent->GetStaticMesh()->GetBounds();
+		MeshBounds = Bounds.BoxExtent * 2.0f * Definition->STModel.Size;
+	}
+	else if (SkeletalMeshComponent && SkeletalMeshComponent->IsVisible() && SkeletalMeshComponent->GetSkeletalMeshAsset())
+	{
+		FBoxSphereBounds Bounds = SkeletalMeshComponent->GetSkeletalMeshAsset()->GetBounds();
+		MeshBounds = Bounds.BoxExtent * 2.0f * Definition->STModel.Size;
+	}
+
+	float MaxDimension = FMath::Max3(MeshBounds.X, MeshBounds.Y, MeshBounds.Z);
+
+	// Se o mesh for menor que o tamanho mínimo, usar o tamanho mínimo
+	// Caso contrário, usar o dobro do tamanho do mesh
+	if (MaxDimension < Definition->CollisionSphereSettings.MinimumSize)
+	{
+		InteractionRadius = Definition->CollisionSphereSettings.MinimumSize;
 	}
 	else
 	{
-		SphereRadius = MaxDimension * 2.0f;
+		InteractionRadius = MaxDimension * 2.0f;
+	}
+
+	if (Proximity)
+	{
+		Proximity->UpdateItemRadius(ProximityHandle, InteractionRadius);
 	}
-	
-	CollisionSphere->SetSphereRadius(SphereRadius);
 }
 
 void AMasterItem::SetupLight()
@@ -365,109 +810,127 @@ void AMasterItem::SetupLight()
 	if (SpotLight)
 	{
 		SpotLight->SetRelativeRotation(FRotator(-90.0f, 0.0f, 0.0f));
-		SpotLight->SetIntensity(LightSettings.Intensity);
-		SpotLight->SetAttenuationRadius(LightSettings.AttenuationRadius);
+		SpotLight->SetIntensity(Definition->LightSettings.Intensity);
+		SpotLight->SetAttenuationRadius(Definition->LightSettings.AttenuationRadius);
 		SpotLight->SetLightColor(GetRarityColor());
-		SpotLight->SetVisibility(false);
 	}
 }
 
-void AMasterItem::SetupWidgets()
+bool AMasterItem::PrepareHoverKernel(FItemRuntimeState& State)
 {
-	if (WidgetInstructionComponent)
+	// Transições (início do hover, retorno ao repouso, root sem proxy) continuam no UpdateItem
+	if (!State.bUsingVisualProxy || !Definition || UItemManagerSubsystem::IsServerProfileActive(GetWorld()))
 	{
-		WidgetInstructionComponent->SetWidgetSpace(EWidgetSpace::Screen);
-		WidgetInstructionComponent->SetDrawSize(WidgetsSettings.WidgetInstructionSize);
-		// Garantir que não está anexado a nenhum componente
-		WidgetInstructionComponent->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
-		// WidgetInstruction usa posição fixa no mundo, não relativa ao item
-		WidgetInstructionWorldLocation = GetActorLocation() + WidgetsSettings.WidgetInstructionPosition;
-		WidgetInstructionComponent->SetWorldLocation(WidgetInstructionWorldLocation);
-		if (WidgetsSettings.WidgetInstruction)
-		{
-			WidgetInstructionComponent->SetWidgetClass(WidgetsSettings.WidgetInstruction);
-		}
-		WidgetInstructionComponent->SetVisibility(false);
+		return false;
 	}
 
-	if (WidgetPickupComponent)
+	if (OverlappingPlayers.Num() > 0)
 	{
-		WidgetPickupComponent->SetWidgetSpace(EWidgetSpace::Screen);
-		WidgetPickupComponent->SetDrawSize(WidgetsSettings.WidgetPickupSize);
-		WidgetPickupComponent->SetRelativeLocation(WidgetsSettings.WidgetPickupPosition);
-		if (WidgetsSettings.WidgetPickup)
-		{
-			WidgetPickupComponent->SetWidgetClass(WidgetsSettings.WidgetPickup);
-		}
-		WidgetPickupComponent->SetVisibility(false);
+		OverlappingPlayers.RemoveAll([](ACharacter* Player) { return !IsValid(Player); });
 	}
+
+	if (!bEasyMode && OverlappingPlayers.Num() == 0)
+	{
+		return false;
+	}
+
+	UpdateLight(State);
+	return true;
 }
 
-void AMasterItem::UpdateFloating(float DeltaTime)
+void AMasterItem::UpdateFloating(float DeltaTime, FItemRuntimeState& State)
 {
-	if (!FloatingSettings.Floating) return;
+	if (!Definition->FloatingSettings.Floating) return;
 
-	UStaticMeshComponent* ActiveMesh = StaticMeshComponent && StaticMeshComponent->IsVisible() ? StaticMeshComponent : nullptr;
-	USkeletalMeshComponent* ActiveSkeletalMesh = SkeletalMeshComponent && SkeletalMeshComponent->IsVisible() ? SkeletalMeshComponent : nullptr;
+	// Modo cosmético: o root fica parado, apenas o proxy sobe até a altura de flutuação
+	if (State.bUsingVisualProxy)
+	{
+		if (!State.bIsFloating)
+		{
+			State.bIsFloating = true;
+			ITEM_TRACE(FloatStart, this, 1);
+		}
+		State.VisualHeight = ItemInterpTo(State.VisualHeight, Definition->FloatingSettings.Height, DeltaTime, Definition->FloatingSettings.FloatingTransitionSpeed);
+		return;
+	}
 
-	if (!ActiveMesh && !ActiveSkeletalMesh) return;
+	UPrimitiveComponent* Body = Cast<UPrimitiveComponent>(RootComponent);
+	if (!Body || !Body->IsVisible()) return;
 
 	// Ativar floating
-	if (!bIsFloating)
+	if (!State.bIsFloating)
 	{
-		bIsFloating = true;
-		if (ActiveMesh)
-		{
-			ActiveMesh->SetSimulatePhysics(false);
-		}
-		if (ActiveSkeletalMesh)
+		State.bIsFloating = true;
+		ITEM_TRACE(FloatStart, this, 0);
+		ITEM_TRACE(PhysicsToggle, this, 0);
+		// O root passa a ser movido aqui: sair do detector e desligar a física já (item assentado já está kinematic)
+		if (Physics)
 		{
-			ActiveSkeletalMesh->SetSimulatePhysics(false);
+			Physics->UntrackItem(this);
 		}
-		OriginalLocation = GetActorLocation();
+		UItemPhysicsSubsystem::SetBodySimulating(Body, false);
+		State.OriginalLocation = GetActorLocation();
 	}
 
 	// Interpolar altura
-	float TargetHeight = OriginalLocation.Z + FloatingSettings.Height;
+	float TargetHeight = State.OriginalLocation.Z + Definition->FloatingSettings.Height;
 	FVector CurrentLocation = GetActorLocation();
 	FVector TargetLocation = FVector(CurrentLocation.X, CurrentLocation.Y, TargetHeight);
-	FVector NewLocation = FMath::VInterpTo(CurrentLocation, TargetLocation, DeltaTime, FloatingSettings.FloatingTransitionSpeed);
+	FVector NewLocation = ItemInterpTo(CurrentLocation, TargetLocation, DeltaTime, Definition->FloatingSettings.FloatingTransitionSpeed);
 	
 	SetActorLocation(NewLocation);
+	INC_DWORD_STAT(STAT_MasterItemHoverRootMoves);
 }
 
-void AMasterItem::UpdateRotation(float DeltaTime)
+void AMasterItem::UpdateRotation(float DeltaTime, FItemRuntimeState& State)
 {
-	if (!RotationSettings.Rotate) return;
+	if (!Definition->RotationSettings.Rotate) return;
 
-	bool bEasyModeActive = BasicInfos.EasyMode;
+	// No modo cosmético a rotação fica em State.CurrentRotation e é aplicada ao proxy
+	auto GetItemRotation = [this, &State]() { return State.bUsingVisualProxy ? State.CurrentRotation : GetActorRotation(); };
+	auto SetItemRotation = [this, &State](const FRotator& NewRotation)
+	{
+		if (State.bUsingVisualProxy)
+		{
+			State.CurrentRotation = NewRotation;
+		}
+		else
+		{
+			SetActorRotation(NewRotation);
+			INC_DWORD_STAT(STAT_MasterItemHoverRootMoves);
+		}
+	};
+
+	bool bEasyModeActive = bEasyMode;
 
 	// Em EasyMode, pular o reset e começar a rotacionar diretamente
 	if (bEasyModeActive)
 	{
-		if (!bIsRotating)
+		if (!State.bIsRotating)
 		{
-			bIsRotating = true;
-			bIsResettingRotation = false;
+			State.bIsRotating = true;
+			State.bIsResettingRotation = false;
+			ITEM_TRACE(RotateStart, this, 0);
 		}
 	}
 	else
 	{
 		// Se precisa resetar e ainda não terminou o reset
-		if (RotationSettings.Reset && !bIsResettingRotation && !bIsRotating)
+		if (Definition->RotationSettings.Reset && !State.bIsResettingRotation && !State.bIsRotating)
 		{
-			bIsResettingRotation = true;
+			State.bIsResettingRotation = true;
+			ITEM_TRACE(RotateReset, this, 0);
 		}
 
 		// Se está resetando, interpolar para zero
-		if (bIsResettingRotation)
+		if (State.bIsResettingRotation)
 		{
-			FRotator CurrentRot = GetActorRotation();
+			FRotator CurrentRot = GetItemRotation();
 			FRotator TargetRotation = FRotator::ZeroRotator;
 			
 			// Interpolar para a rotação zero
-			FRotator NewRotation = FMath::RInterpTo(CurrentRot, TargetRotation, DeltaTime, RotationSettings.ResetSpeed);
-			SetActorRotation(NewRotation);
+			FRotator NewRotation = ItemRInterpTo(CurrentRot, TargetRotation, DeltaTime, Definition->RotationSettings.ResetSpeed);
+			SetItemRotation(NewRotation);
 			
 			// Verificar se chegou perto de zero
 			if (FMath::IsNearlyEqual(NewRotation.Yaw, 0.0f, 1.0f) &&
@@ -475,9 +938,10 @@ void AMasterItem::UpdateRotation(float DeltaTime)
 				FMath::IsNearlyEqual(NewRotation.Roll, 0.0f, 1.0f))
 			{
 				// Reset completo, pode começar a rotacionar
-				SetActorRotation(TargetRotation); // Garantir que está exatamente em zero
-				bIsResettingRotation = false;
-				bIsRotating = true;
+				SetItemRotation(TargetRotation); // Garantir que está exatamente em zero
+				State.bIsResettingRotation = false;
+				State.bIsRotating = true;
+				ITEM_TRACE(RotateStart, this, 0);
 			}
 			else
 			{
@@ -487,22 +951,23 @@ void AMasterItem::UpdateRotation(float DeltaTime)
 		}
 
 		// Se não precisa resetar e ainda não começou a rotacionar, começar agora
-		if (!RotationSettings.Reset && !bIsRotating)
+		if (!Definition->RotationSettings.Reset && !State.bIsRotating)
 		{
-			bIsRotating = true;
-			OriginalRotation = GetActorRotation();
+			State.bIsRotating = true;
+			State.OriginalRotation = GetItemRotation();
+			ITEM_TRACE(RotateStart, this, 0);
 		}
 	}
 
 	// Agora rotacionar
-	if (bIsRotating)
+	if (State.bIsRotating)
 	{
-		FRotator CurrentRot = GetActorRotation();
+		FRotator CurrentRot = GetItemRotation();
 		FRotator DeltaRotation = FRotator::ZeroRotator;
 
-		float RotationDelta = RotationSettings.RotationSpeed * DeltaTime;
+		float RotationDelta = Definition->RotationSettings.RotationSpeed * DeltaTime;
 
-		switch (RotationSettings.DirectionRotation)
+		switch (Definition->RotationSettings.DirectionRotation)
 		{
 		case EDirectionRotation::X:
 			DeltaRotation.Roll = RotationDelta;
@@ -516,89 +981,234 @@ void AMasterItem::UpdateRotation(float DeltaTime)
 		}
 
 		FRotator NewRotation = CurrentRot + DeltaRotation;
-		SetActorRotation(NewRotation);
+		SetItemRotation(NewRotation);
 	}
 }
 
-void AMasterItem::UpdateLight()
+void AMasterItem::UpdateLight(FItemRuntimeState& State)
 {
-	if (!LightSettings.Light) return;
+	if (!Definition->LightSettings.Light) return;
 
-	if (SpotLight)
+	// O UItemLightSubsystem decide se o item recebe o spotlight ou o fallback emissivo
+	if (!State.bIsLightOn)
 	{
-		if (!bIsLightOn)
+		State.bIsLightOn = true;
+		if (UItemLightSubsystem* LightBudget = GetWorld()->GetSubsystem<UItemLightSubsystem>())
 		{
-			bIsLightOn = true;
-			SpotLight->SetVisibility(true);
-			SpotLight->SetLightColor(GetRarityColor());
+			LightBudget->RequestLight(this);
 		}
-		// Garantir que a luz permaneça acesa
-		if (!SpotLight->IsVisible())
+	}
+}
+
+void AMasterItem::ReleaseLight()
+{
+	if (UItemLightSubsystem* LightBudget = GetWorld()->GetSubsystem<UItemLightSubsystem>())
+	{
+		LightBudget->ReleaseLight(this);
+	}
+}
+
+void AMasterItem::SetLightActive(bool bActive)
+{
+	if (bActive)
+	{
+		if (USpotLightComponent* Light = GetOrCreateSpotLight())
 		{
-			SpotLight->SetVisibility(true);
+			Light->SetLightColor(GetRarityColor());
+			Light->SetVisibility(true);
 		}
 	}
+	else if (SpotLight)
+	{
+		SpotLight->SetVisibility(false);
+	}
 }
 
-void AMasterItem::UpdateWidgets()
+void AMasterItem::SetEmissiveFallback(bool bEnabled)
 {
-	// Verificar se o player local está na lista de overlapping players
-	APlayerController* LocalPlayerController = GetWorld() ? GetWorld()->GetFirstPlayerController() : nullptr;
-	ACharacter* LocalPlayerCharacter = LocalPlayerController ? Cast<ACharacter>(LocalPlayerController->GetPawn()) : nullptr;
-	
-	bool bLocalPlayerIsOverlapping = LocalPlayerCharacter && OverlappingPlayers.Contains(LocalPlayerCharacter);
+	// Materiais dos itens leem a cor da raridade (RGB) e a intensidade (A) do Custom Primitive Data
+	const FLinearColor Color = GetRarityColor();
+	const FVector4 EmissiveData(Color.R, Color.G, Color.B, bEnabled ? 1.0f : 0.0f);
 
-	if (bLocalPlayerIsOverlapping)
+	UPrimitiveComponent* Meshes[] = { StaticMeshComponent, SkeletalMeshComponent, VisualStaticMesh, VisualSkeletalMesh };
+	for (UPrimitiveComponent* Mesh : Meshes)
 	{
-		if (WidgetInstructionComponent && WidgetsSettings.WidgetInstruction)
+		if (Mesh)
 		{
-			WidgetInstructionComponent->SetVisibility(true);
+			Mesh->SetCustomPrimitiveDataVector4(UItemLightSubsystem::EmissiveCustomDataIndex, EmissiveData);
 		}
+	}
+}
 
-		if (WidgetPickupComponent && WidgetsSettings.WidgetPickup)
+USpotLightComponent* AMasterItem::GetOrCreateSpotLight()
+{
+	if (!SpotLight)
+	{
+		SpotLight = NewObject<USpotLightComponent>(this, TEXT("SpotLight"));
+		SpotLight->SetupAttachment(RootComponent);
+		SpotLight->SetVisibility(false);
+		SpotLight->RegisterComponent();
+		SetupLight();
+	}
+	return SpotLight;
+}
+
+void AMasterItem::BeginVisualHover(FItemRuntimeState& State)
+{
+	State.bUsingVisualProxy = true;
+	State.VisualHeight = 0.0f;
+	State.CurrentRotation = GetActorRotation();
+
+	SyncVisualProxy();
+	ApplyVisualTransform(State);
+}
+
+void AMasterItem::EndVisualHover()
+{
+	if (!IsVisualProxyActive())
+	{
+		return;
+	}
+
+	if (VisualStaticMesh)
+	{
+		VisualStaticMesh->SetVisibility(false);
+	}
+	if (VisualSkeletalMesh)
+	{
+		VisualSkeletalMesh->SetVisibility(false);
+	}
+
+	// Reexibir o mesh real (continua com física e colisão o tempo todo)
+	if (Definition && Definition->STModel.MeshType == EMeshType::Skeletal)
+	{
+		if (SkeletalMeshComponent)
 		{
-			WidgetPickupComponent->SetVisibility(true);
+			SkeletalMeshComponent->SetVisibility(true);
 		}
 	}
+	else if (StaticMeshComponent)
+	{
+		StaticMeshComponent->SetVisibility(true);
+	}
+}
+
+bool AMasterItem::ReturnVisualToRest(float DeltaTime, FItemRuntimeState& State)
+{
+	const FRotator RestRotation = GetActorRotation();
+	State.VisualHeight = ItemInterpTo(State.VisualHeight, 0.0f, DeltaTime, Definition->FloatingSettings.FloatingTransitionSpeed);
+	State.CurrentRotation = ItemRInterpTo(State.CurrentRotation, RestRotation, DeltaTime, Definition->RotationSettings.ResetSpeed);
+
+	const bool bAtRest = FMath::IsNearlyZero(State.VisualHeight, 0.5f) && State.CurrentRotation.Equals(RestRotation, 1.0f);
+	if (!bAtRest)
+	{
+		ApplyVisualTransform(State);
+	}
+	return bAtRest;
+}
+
+void AMasterItem::ApplyVisualTransform(const FItemRuntimeState& State)
+{
+	UPrimitiveComponent* VisualProxy = Definition->STModel.MeshType == EMeshType::Skeletal ? static_cast<UPrimitiveComponent*>(VisualSkeletalMesh) : VisualStaticMesh;
+	if (VisualProxy)
+	{
+		VisualProxy->SetWorldLocationAndRotation(GetActorLocation() + FVector(0.0f, 0.0f, State.VisualHeight), State.CurrentRotation);
+		INC_DWORD_STAT(STAT_MasterItemHoverVisualMoves);
+	}
+}
+
+void AMasterItem::SyncVisualProxy()
+{
+	// Servidor dedicado não renderiza: basta o estado, sem proxy
+	if (GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	// Mesh esquelético ainda carregando: ApplyLoadedMesh sincroniza quando ele chegar
+	UMeshComponent* SourceMesh = Definition->STModel.MeshType == EMeshType::Skeletal ? static_cast<UMeshComponent*>(SkeletalMeshComponent) : StaticMeshComponent;
+	UPrimitiveComponent* VisualProxy = SourceMesh ? GetOrCreateVisualProxy() : nullptr;
+	if (!VisualProxy)
+	{
+		return;
+	}
+
+	// Copiar mesh, materiais e escala do mesh real e escondê-lo
+	if (VisualStaticMesh && VisualProxy == VisualStaticMesh)
+	{
+		VisualStaticMesh->SetStaticMesh(StaticMeshComponent->GetStaticMesh());
+	}
+	else if (VisualSkeletalMesh && VisualProxy == VisualSkeletalMesh)
+	{
+		VisualSkeletalMesh->SetSkeletalMesh(SkeletalMeshComponent->GetSkeletalMeshAsset());
+	}
+	for (int32 MaterialIndex = 0; MaterialIndex < SourceMesh->GetNumMaterials(); ++MaterialIndex)
+	{
+		VisualProxy->SetMaterial(MaterialIndex, SourceMesh->GetMaterial(MaterialIndex));
+	}
+	VisualProxy->SetWorldScale3D(SourceMesh->GetComponentScale());
+	VisualProxy->SetVisibility(true);
+	SourceMesh->SetVisibility(false);
+}
+
+UPrimitiveComponent* AMasterItem::GetOrCreateVisualProxy()
+{
+	const bool bIsSkeletal = Definition->STModel.MeshType == EMeshType::Skeletal;
+	UMeshComponent* VisualProxy = bIsSkeletal ? static_cast<UMeshComponent*>(VisualSkeletalMesh) : VisualStaticMesh;
+	if (VisualProxy)
+	{
+		return VisualProxy;
+	}
+
+	if (bIsSkeletal)
+	{
+		VisualSkeletalMesh = NewObject<USkeletalMeshComponent>(this, TEXT("VisualSkeletalMesh"));
+		VisualProxy = VisualSkeletalMesh;
+	}
 	else
 	{
-		// Esconder widgets se o player local não está overlapping
-		if (WidgetInstructionComponent)
-		{
-			WidgetInstructionComponent->SetVisibility(false);
-		}
-		if (WidgetPickupComponent)
-		{
-			WidgetPickupComponent->SetVisibility(false);
-		}
+		VisualStaticMesh = NewObject<UStaticMeshComponent>(this, TEXT("VisualStaticMesh"));
+		VisualProxy = VisualStaticMesh;
 	}
+
+	// Sem colisão nem overlap; transformação absoluta para não depender do root
+	VisualProxy->SetupAttachment(RootComponent);
+	VisualProxy->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	VisualProxy->SetGenerateOverlapEvents(false);
+	VisualProxy->SetCanEverAffectNavigation(false);
+	VisualProxy->SetUsingAbsoluteLocation(true);
+	VisualProxy->SetUsingAbsoluteRotation(true);
+	VisualProxy->SetUsingAbsoluteScale(true);
+	VisualProxy->SetVisibility(false);
+	VisualProxy->RegisterComponent();
+	return VisualProxy;
 }
 
-void AMasterItem::OnCollisionSphereBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+bool AMasterItem::IsVisualProxyActive() const
 {
-	if (ACharacter* Character = Cast<ACharacter>(OtherActor))
+	return (VisualStaticMesh && VisualStaticMesh->IsVisible()) || (VisualSkeletalMesh && VisualSkeletalMesh->IsVisible());
+}
+
+void AMasterItem::OnProximityBegin(ACharacter* Character)
+{
+	if (Character)
 	{
-		// Se já houver um player na lista, ignorar completamente este evento
-		if (OverlappingPlayers.Num() > 0)
+		// Se já houver um player na lista (ou o pickup já foi previsto), ignorar completamente este evento
+		if (OverlappingPlayers.Num() > 0 || bPickupPredicted)
 		{
 			return;
 		}
 		
-		// Verificar se o player está em cooldown
-		if (PlayerCooldowns.Contains(Character))
+		FItemRuntimeState* State = ItemManager ? ItemManager->GetRuntimeState(this) : nullptr;
+		if (!State)
 		{
-			float CurrentTime = GetWorld()->GetTimeSeconds();
-			float CooldownEndTime = PlayerCooldowns[Character];
-			if ((CurrentTime - CooldownEndTime) < OverlapCooldownTime)
-			{
-				// Player ainda está em cooldown, ignorar
-				return;
-			}
-			else
-			{
-				// Cooldown expirado, remover do mapa
-				PlayerCooldowns.Remove(Character);
-			}
+			return;
+		}
+
+		// Player ainda em cooldown, ignorar (a entrada sai do wheel quando vence)
+		if (Cooldowns && Cooldowns->IsOnCooldown(this, Character))
+		{
+			return;
 		}
 		
 		// Verificar se o player já está na lista (não deveria estar, mas verificação de segurança)
@@ -606,67 +1216,514 @@ void AMasterItem::OnCollisionSphereBeginOverlap(UPrimitiveComponent* OverlappedC
 		{
 			// Adicionar à lista (garantido que está vazia)
 			OverlappingPlayers.Add(Character);
+			ITEM_TRACE(OverlapBegin, this, 0);
 			
 			// Inicializar estados para o primeiro player
-			OriginalLocation = GetActorLocation();
-			OriginalRotation = GetActorRotation();
-			CurrentRotation = OriginalRotation;
+			State->OriginalLocation = GetActorLocation();
+			State->OriginalRotation = GetActorRotation();
+			// No modo cosmético CurrentRotation é a rotação exibida pelo proxy, que pode estar voltando ao repouso
+			if (!State->bUsingVisualProxy)
+			{
+				State->CurrentRotation = State->OriginalRotation;
+			}
 			// Resetar flags de rotação para que reset aconteça antes de começar a rotacionar
-			bIsRotating = false;
-			bIsResettingRotation = false;
+			State->bIsRotating = false;
+			State->bIsResettingRotation = false;
+
+			// Player no alcance de interação: voltar a ser um ator completo
+			PromoteFromInstance();
+			ItemManager->WakeItem(this);
+
+			// Os widgets compartilhados passam a seguir este item quando o player é o local
+			if (Character->IsLocallyControlled())
+			{
+				if (UItemWidgetSubsystem* ItemWidgets = GetWorld()->GetSubsystem<UItemWidgetSubsystem>())
+				{
+					ItemWidgets->SetFocusedItem(this);
+				}
+			}
 		}
 	}
 }
 
-void AMasterItem::OnCollisionSphereEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+void AMasterItem::OnProximityEnd(ACharacter* Character)
 {
-	if (ACharacter* Character = Cast<ACharacter>(OtherActor))
+	if (Character)
 	{
 		// Só processar se o player estiver na lista (apenas o player autorizado)
 		if (OverlappingPlayers.Contains(Character))
 		{
 			// Remover da lista (só pode haver um player por vez)
 			OverlappingPlayers.Remove(Character);
+			ITEM_TRACE(OverlapEnd, this, 0);
+
+			if (UItemWidgetSubsystem* ItemWidgets = GetWorld()->GetSubsystem<UItemWidgetSubsystem>())
+			{
+				ItemWidgets->ClearFocusedItem(this);
+			}
 			
-			// Registrar o tempo de saída para iniciar o cooldown
-			float CurrentTime = GetWorld()->GetTimeSeconds();
-			PlayerCooldowns.Add(Character, CurrentTime);
+			// Iniciar o cooldown; o UItemCooldownSubsystem avisa o item no vencimento (mesmo dormindo)
+			if (Cooldowns)
+			{
+				Cooldowns->StartCooldown(this, Character, Definition ? Definition->CollisionSphereSettings.OverlapCooldownTime : 5.0f);
+			}
 			
-			// Os efeitos serão desativados no Tick quando não houver mais players
+			// Os efeitos serão desativados no próximo passe do ItemManager quando não houver mais players
 		}
 	}
 }
 
-void AMasterItem::ValidateItemData()
+void AMasterItem::OnOverlapCooldownExpired()
 {
-	// Validar Name
-	if (Name.IsEmpty())
+	// Um player que ficou dentro do alcance durante o cooldown não gera novo evento de entrada
+	if (OverlappingPlayers.Num() == 0 && Proximity)
+	{
+		TArray<ACharacter*> CharactersInRange;
+		Proximity->GetCharactersInRange(ProximityHandle, CharactersInRange);
+		for (ACharacter* Character : CharactersInRange)
+		{
+			OnProximityBegin(Character);
+			if (OverlappingPlayers.Num() > 0)
+			{
+				break;
+			}
+		}
+	}
+}
+
+void AMasterItem::OnRootTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	if (UpdatedComponent != RootComponent)
+	{
+		return;
+	}
+
+	if (Proximity)
+	{
+		Proximity->UpdateItemLocation(ProximityHandle, GetActorLocation());
+	}
+	if (ItemRegistry)
+	{
+		ItemRegistry->UpdateItemLocation(ItemRegistryHandle, GetActorLocation());
+	}
+}
+
+void AMasterItem::SetEasyMode(bool bEnabled)
+{
+	if (bEasyMode == bEnabled)
+	{
+		return;
+	}
+
+	bEasyMode = bEnabled;
+
+	// Ligar ou desligar o EasyMode exige pelo menos um passe (ativar efeitos ou voltar ao repouso)
+	PromoteFromInstance();
+	if (ItemManager)
+	{
+		ItemManager->WakeItem(this);
+	}
+}
+
+void AMasterItem::OnFellAsleep()
+{
+	// Esperar a física assentar antes de virar instância e dormir na rede
+	// Corpo ainda simulando: o detector de repouso chama CheckSettled quando ele parar
+	if (Definition && !IsInstanced())
+	{
+		const UPrimitiveComponent* Body = Cast<UPrimitiveComponent>(RootComponent);
+		if (Physics && Body && Body->IsSimulatingPhysics())
+		{
+			Physics->TrackItem(this);
+		}
+		else
+		{
+			CheckSettled();
+		}
+	}
+}
+
+void AMasterItem::OnWokeUp()
+{
+	// Floating e rotação movem o ator no servidor: o movimento precisa voltar a replicar
+	SetNetDormant(false);
+}
+
+void AMasterItem::CheckSettled()
+{
+	// Chamado pelo detector de repouso ou por OnFellAsleep com o corpo já parado
+	// Acordou nesse meio tempo, ainda fora do registro ou no pool: continua como ator
+	if (!ItemManager || ItemManagerIndex == INDEX_NONE || ItemManager->IsItemAwake(this) || IsInstanced() || bIsInPool)
+	{
+		return;
+	}
+
+	// Mesh ainda carregando: ApplyLoadedMesh chama OnFellAsleep de novo quando ele chegar
+	const bool bIsStatic = Definition->STModel.MeshType == EMeshType::Static;
+	UPrimitiveComponent* Body = bIsStatic ? static_cast<UPrimitiveComponent*>(StaticMeshComponent) : SkeletalMeshComponent;
+	if (!Body || (bIsStatic && StaticMeshComponent->GetStaticMesh() == PlaceholderMesh))
+	{
+		return;
+	}
+
+	SetNetDormant(true);
+
+	// Servidor: pilhas iguais assentadas por perto podem ser unidas a este item
+	if (UItemStackMergeSubsystem* StackMerge = GetWorld()->GetSubsystem<UItemStackMergeSubsystem>())
+	{
+		StackMerge->AddCandidate(this);
+	}
+
+	// Perfil de servidor: sem trabalho de apresentação
+	if (bIsStatic && !UItemManagerSubsystem::IsServerProfileActive(GetWorld()))
+	{
+		if (UItemInstancedRenderSubsystem* InstancedRender = GetWorld()->GetSubsystem<UItemInstancedRenderSubsystem>())
+		{
+			InstancedRender->CollapseItem(this);
+		}
+	}
+}
+
+void AMasterItem::ApplyExternalImpulse(FVector Impulse, bool bVelocityChange)
+{
+	PromoteFromInstance();
+
+	UPrimitiveComponent* Body = Cast<UPrimitiveComponent>(RootComponent);
+	if (!Body)
+	{
+		return;
+	}
+
+	// O impulso precisa do corpo simulando neste frame: religar sem esperar o lote
+	if (Physics)
+	{
+		Physics->UntrackItem(this);
+	}
+	UItemPhysicsSubsystem::SetBodySimulating(Body, true);
+	Body->AddImpulse(Impulse, NAME_None, bVelocityChange);
+
+	// O movimento volta a replicar até o item assentar de novo
+	SetNetDormant(false);
+	if (Physics)
+	{
+		Physics->TrackItem(this);
+	}
+}
+
+void AMasterItem::SetNetDormant(bool bDormant)
+{
+	// Dormência só faz sentido no servidor de um jogo em rede
+	if (!HasAuthority() || GetNetMode() == NM_Standalone)
+	{
+		return;
+	}
+
+	// Item na lista replicada da célula: acordar devolve o ator à replicação
+	if (IsInWorldList())
+	{
+		if (!bDormant && WorldList)
+		{
+			WorldList->RemoveItem(this);
+			SetReplicates(true);
+		}
+		return;
+	}
+
+	if (!GetIsReplicated())
+	{
+		return;
+	}
+
+	// Em vez de um canal dormente por item, um registro na lista da célula (andromeda.Items.WorldList)
+	const bool bIsDormant = NetDormancy == DORM_DormantAll;
+	if (bDormant && !bIsDormant && WorldList && WorldList->AddItem(this))
+	{
+		return;
+	}
+
+	if (bDormant && !CVarItemNetDormancy.GetValueOnGameThread())
+	{
+		return;
+	}
+
+	if (bDormant == bIsDormant)
+	{
+		return;
+	}
+
+	SetNetDormancy(bDormant ? DORM_DormantAll : DORM_Awake);
+	if (bDormant)
+	{
+		INC_DWORD_STAT(STAT_MasterItemNetDormant);
+	}
+	else
+	{
+		DEC_DWORD_STAT(STAT_MasterItemNetDormant);
+	}
+}
+
+void AMasterItem::SetQuantity(int32 NewQuantity)
+{
+	if (!HasAuthority() || NewQuantity == Quantity)
+	{
+		return;
+	}
+
+	Quantity = NewQuantity;
+	ValidateItemData();
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMasterItem, Quantity, this);
+
+	// Envia a nova quantidade sem tirar o item da dormência (ou só a entrada dele na lista da célula)
+	if (IsInWorldList())
+	{
+		WorldList->UpdateItem(this);
+	}
+	else
+	{
+		FlushNetDormancy();
+	}
+}
+
+bool AMasterItem::RequestPickup(ACharacter* Picker, int32 RequestedQuantity)
+{
+	if (!Picker || bPickupPredicted || bIsInPool || IsActorBeingDestroyed())
+	{
+		return false;
+	}
+
+	UItemPickupComponent* PickupComponent = UItemPickupComponent::FindForCharacter(Picker);
+	if (!PickupComponent)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AMasterItem: controller de %s não tem UItemPickupComponent"), *Picker->GetName());
+		return false;
+	}
+
+	if (!PickupComponent->QueuePickup(this, RequestedQuantity))
+	{
+		return false;
+	}
+
+	// Predição só no cliente e só quando o pedido leva a pilha inteira
+	if (!HasAuthority() && (RequestedQuantity <= 0 || RequestedQuantity >= Quantity))
+	{
+		SetPickupPredicted(true);
+	}
+	return true;
+}
+
+int32 AMasterItem::ServerTryPickup(ACharacter* Picker, int32 RequestedQuantity, bool& bOutRemoved)
+{
+	bOutRemoved = false;
+	if (!HasAuthority() || !Picker || !Definition || bIsInPool || IsActorBeingDestroyed())
+	{
+		return 0;
+	}
+
+	// Elegibilidade: o player precisa estar no alcance de interação (com folga para a diferença de posição cliente/servidor)
+	const float MaxDistance = InteractionRadius + CVarItemPickupTolerance.GetValueOnGameThread();
+	if (FVector::DistSquared(Picker->GetActorLocation(), GetActorLocation()) > FMath::Square(MaxDistance))
+	{
+		return 0;
+	}
+
+	// Divisão atômica: pedidos são resolvidos em série, o próximo já vê a quantidade restante
+	const int32 Granted = RequestedQuantity > 0 ? FMath::Min(RequestedQuantity, Quantity) : Quantity;
+	if (Granted < Quantity)
+	{
+		SetQuantity(Quantity - Granted);
+		return Granted;
+	}
+
+	bOutRemoved = true;
+	if (UItemPoolSubsystem* Pool = GetWorld()->GetSubsystem<UItemPoolSubsystem>())
+	{
+		Pool->ReleaseItem(this);
+	}
+	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("AMasterItem: Name está vazio! Item será destruído."));
 		Destroy();
+	}
+	return Granted;
+}
+
+void AMasterItem::SetPickupPredicted(bool bPredicted)
+{
+	if (bPickupPredicted == bPredicted)
+	{
 		return;
 	}
 
+	bPickupPredicted = bPredicted;
+	if (bPredicted)
+	{
+		// A instância do HISM não é escondida junto com o ator
+		PromoteFromInstance();
+		if (UItemWidgetSubsystem* ItemWidgets = GetWorld()->GetSubsystem<UItemWidgetSubsystem>())
+		{
+			ItemWidgets->ClearFocusedItem(this);
+		}
+	}
+
+	SetActorHiddenInGame(bPredicted);
+	SetActorEnableCollision(!bPredicted);
+}
+
+void AMasterItem::PromoteFromInstance()
+{
+	if (IsInstanced())
+	{
+		if (UItemInstancedRenderSubsystem* InstancedRender = GetWorld()->GetSubsystem<UItemInstancedRenderSubsystem>())
+		{
+			InstancedRender->PromoteItem(this);
+		}
+	}
+}
+
+void AMasterItem::InitializeItem(UItemDefinition* InDefinition, int32 InQuantity)
+{
+	Definition = InDefinition;
+	ID = InDefinition ? InDefinition->ID : NAME_None;
+	Quantity = InQuantity;
+	bEasyMode = InDefinition && InDefinition->BasicInfos.EasyMode;
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMasterItem, ID, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(AMasterItem, Quantity, this);
+}
+
+bool AMasterItem::ResolveDefinition()
+{
+	if (Definition && Definition->ID == ID)
+	{
+		return true;
+	}
+
+	UItemDefinitionRegistry* Registry = UItemDefinitionRegistry::Get(this);
+	Definition = Registry ? Registry->FindDefinition(ID) : nullptr;
+	if (Definition)
+	{
+		bEasyMode = Definition->BasicInfos.EasyMode;
+	}
+	return Definition != nullptr;
+}
+
+void AMasterItem::OnRep_ID()
+{
+	// Só reconfigurar se o item já passou pelo BeginPlay (o BeginPlay resolve a definição inicial)
+	// ID desconhecido neste cliente: ValidateItemData desativa o item (UpdateItem e os subsystems supõem Definition válida)
+	if (HasActorBegunPlay() && ValidateItemData() && Definition)
+	{
+		SetupMesh();
+		SetupInteractionRange();
+
+		// Raridade e estado vêm da definição: reindexar
+		if (ItemRegistry)
+		{
+			ItemRegistry->UnregisterItem(ItemRegistryHandle);
+			ItemRegistryHandle = ItemRegistry->RegisterItem(this);
+		}
+	}
+}
+
+bool AMasterItem::ValidateItemData()
+{
+	// Validar Definição
+	if (!ResolveDefinition())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AMasterItem: Definição não encontrada para o ID '%s'! Item será destruído."), *ID.ToString());
+		ITEM_TRACE(ValidationFailed, this, EItemTraceValidation::MissingDefinition);
+		DiscardInvalidItem();
+		return false;
+	}
+
+	// Validar Name
+	if (Definition->Name.IsEmpty())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AMasterItem: Name está vazio! Item será destruído."));
+		ITEM_TRACE(ValidationFailed, this, EItemTraceValidation::EmptyName);
+		DiscardInvalidItem();
+		return false;
+	}
+
 	// Validar Quantity
+	const int32 PreviousQuantity = Quantity;
 	if (Quantity <= 0)
 	{
 		Quantity = 1;
 	}
 
 	// Se não é stackable, força quantidade = 1
-	if (!STQty.Stackable)
+	if (!Definition->STQty.Stackable)
 	{
 		Quantity = 1;
 	}
-	else if (Quantity > STQty.MaxQty)
+	else if (Quantity > Definition->STQty.MaxQty)
+	{
+		Quantity = Definition->STQty.MaxQty;
+	}
+
+	if (Quantity != PreviousQuantity)
 	{
-		Quantity = STQty.MaxQty;
+		ITEM_TRACE(ValidationFailed, this, EItemTraceValidation::QuantityClamped);
+		MARK_PROPERTY_DIRTY_FROM_NAME(AMasterItem, Quantity, this);
 	}
+	return true;
+}
+
+void AMasterItem::DiscardInvalidItem()
+{
+	if (HasAuthority())
+	{
+		Destroy();
+		return;
+	}
+
+	// Cliente: Destroy de um ator replicado falha (só o servidor remove); desligar até o canal fechar
+	PromoteFromInstance();
+	EndVisualHover();
+
+	if (UItemWidgetSubsystem* ItemWidgets = GetWorld()->GetSubsystem<UItemWidgetSubsystem>())
+	{
+		ItemWidgets->ClearFocusedItem(this);
+	}
+	ReleaseLight();
+
+	if (ItemManager)
+	{
+		ItemManager->UnregisterItem(this);
+		ItemManager = nullptr;
+	}
+	if (Proximity)
+	{
+		Proximity->UnregisterItem(ProximityHandle);
+		ProximityHandle = INDEX_NONE;
+		Proximity = nullptr;
+	}
+	if (ItemRegistry)
+	{
+		ItemRegistry->UnregisterItem(ItemRegistryHandle);
+		ItemRegistryHandle = INDEX_NONE;
+		ItemRegistry = nullptr;
+	}
+	if (Physics)
+	{
+		Physics->UntrackItem(this);
+		Physics = nullptr;
+	}
+	OverlappingPlayers.Reset();
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetActorTickEnabled(false);
 }
 
 FLinearColor AMasterItem::GetRarityColor() const
 {
-	switch (STInfos.Rarity)
+	if (!Definition)
+	{
+		return FLinearColor::White;
+	}
+
+	switch (Definition->STInfos.Rarity)
 	{
 	case EItemRarity::Prototype:	// Amarelo
 		return FLinearColor(1.0f, 0.84f, 0.0f, 1.0f);
@@ -689,7 +1746,9 @@ void AMasterItem::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifet
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(AMasterItem, Name);
-	DOREPLIFETIME(AMasterItem, ID);
-	DOREPLIFETIME(AMasterItem, Quantity);
+	// Push-model: o net driver só compara estas propriedades quando marcadas como sujas
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMasterItem, ID, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AMasterItem, Quantity, Params);
 }
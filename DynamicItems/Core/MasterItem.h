@@ -1,4 +1,4 @@
-// Dynamic item system // Version 1.0.0 // date: 2026-01-29 // last update: 2026-01-29 // Author: Pilha-DS // Actor: MasterItem
+// Dynamic item system // Version 1.0.0 // date: 2026-01-29 // last update: 2026-10-16 // Author: Pilha-DS // Actor: MasterItem
 
 #pragma once
 
@@ -6,18 +6,24 @@
 #include "GameFramework/Actor.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/SkeletalMeshComponent.h"
-#include "Components/SphereComponent.h"
 #include "Components/SpotLightComponent.h"
-#include "Components/WidgetComponent.h"
 #include "AndromedaSystemsC/DynamicItems/Structure/ItemStructures.h"
 #include "MasterItem.generated.h"
 
 class UStaticMeshComponent;
 class USkeletalMeshComponent;
-class USphereComponent;
 class USpotLightComponent;
-class UWidgetComponent;
 class ACharacter;
+class UItemManagerSubsystem;
+class UItemProximitySubsystem;
+class UItemRegistrySubsystem;
+class UItemLightSubsystem;
+class UItemCooldownSubsystem;
+class UItemPhysicsSubsystem;
+class UItemWorldListSubsystem;
+class AItemWorldListActor;
+class UItemDefinition;
+struct FItemRuntimeState;
 
 /**
  * Classe base para todos os itens do jogo
@@ -27,117 +33,242 @@ UCLASS(BlueprintType, Blueprintable)
 class ANDROMEDA_API AMasterItem : public AActor
 {
 	GENERATED_BODY()
+
+	friend class UItemManagerSubsystem;
+	friend class UItemInstancedRenderSubsystem;
+	friend class UItemProximitySubsystem;
+	friend class UItemLightSubsystem;
+	friend class UItemCooldownSubsystem;
+	friend class UItemPhysicsSubsystem;
+	friend class UItemStackMergeSubsystem;
+	friend class UItemWorldListSubsystem;
+	friend class AItemWorldListActor;
 	
 public:	
 	AMasterItem(const FObjectInitializer& ObjectInitializer);
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	// Usado apenas quando andromeda.Items.BatchedTick = 0 (caminho legado por ator, para comparação de custo)
 	virtual void Tick(float DeltaTime) override;
+	// Cliente: o servidor moveu o ator; a instância no HISM ficaria parada na posição antiga
+	virtual void PostNetReceiveLocationAndRotation() override;
 
 	// Componentes
+	// Só existe o mesh do MeshType da definição; o outro é nulo (root trocado por SetMeshRoot)
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components", meta = (AllowPrivateAccess = "true"))
 	TObjectPtr<UStaticMeshComponent> StaticMeshComponent;
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components", meta = (AllowPrivateAccess = "true"))
+	// Criado sob demanda quando o mesh esquelético termina de carregar
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "Components", meta = (AllowPrivateAccess = "true"))
 	TObjectPtr<USkeletalMeshComponent> SkeletalMeshComponent;
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components", meta = (AllowPrivateAccess = "true"))
-	TObjectPtr<USphereComponent> CollisionSphere;
-
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components", meta = (AllowPrivateAccess = "true"))
+	// Criado sob demanda quando o UItemLightSubsystem concede uma luz ao item
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "Components", meta = (AllowPrivateAccess = "true"))
 	TObjectPtr<USpotLightComponent> SpotLight;
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components", meta = (AllowPrivateAccess = "true"))
-	TObjectPtr<UWidgetComponent> WidgetInstructionComponent;
+	// Proxies visuais sem colisão usados no modo cosmético de flutuação (criados sob demanda)
+	UPROPERTY(Transient)
+	TObjectPtr<UStaticMeshComponent> VisualStaticMesh;
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components", meta = (AllowPrivateAccess = "true"))
-	TObjectPtr<UWidgetComponent> WidgetPickupComponent;
+	UPROPERTY(Transient)
+	TObjectPtr<USkeletalMeshComponent> VisualSkeletalMesh;
 
 	// Dados do Item
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, Category = "Item")
-	FString Name;
+	// Apenas o ID é serializado e replicado; a configuração vem da UItemDefinition compartilhada
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, ReplicatedUsing = OnRep_ID, Category = "Item", meta = (GetOptions = "ItemDefinitionRegistry.GetItemDefinitionIds"))
+	FName ID;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, Category = "Item")
-	FString ID;
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "Item")
+	TObjectPtr<UItemDefinition> Definition;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, Category = "Item", meta = (ClampMin = "1"))
+	// Replicação push-model: alterar apenas por SetQuantity no servidor
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Replicated, Category = "Item", meta = (ClampMin = "1"))
 	int32 Quantity = 1;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item")
-	FSTModel STModel;
+	// Flags de runtime (inicializadas a partir da definição)
+	bool bEasyMode = false;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item")
-	FSTQty STQty;
+	// Mesh exibido enquanto STModel é carregado de forma assíncrona
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Model")
+	TObjectPtr<UStaticMesh> PlaceholderMesh;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item")
-	FSTInfos STInfos;
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Model")
+	float PlaceholderScale = 0.25f;
 
-	// WorldView Settings
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WorldView")
-	FBasicInfos BasicInfos;
+	// Estados internos
+	// Floating, rotação e luz ficam no UItemManagerSubsystem (FItemRuntimeState)
+	TArray<ACharacter*> OverlappingPlayers;
+	FVector WidgetInstructionWorldLocation; // Posição fixa do widget de instrução no mundo (UItemWidgetSubsystem)
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WorldView")
-	FFloatingSettings FloatingSettings;
+	UPROPERTY(Transient)
+	TObjectPtr<UItemManagerSubsystem> ItemManager;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WorldView")
-	FRotationSettings RotationSettings;
+	int32 ItemManagerIndex = INDEX_NONE; // Índice nos arrays do ItemManager
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WorldView")
-	FLightSettings LightSettings;
+	// Alcance de interação (UItemProximitySubsystem), substitui a antiga CollisionSphere
+	UPROPERTY(Transient)
+	TObjectPtr<UItemProximitySubsystem> Proximity;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WorldView")
-	FCollisionSphereSettings CollisionSphereSettings;
+	int32 ProximityHandle = INDEX_NONE; // Handle no spatial hash de proximidade
+	float InteractionRadius = 50.0f; // Raio calculado a partir dos bounds do mesh
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WorldView")
-	FWidgetsSettings WidgetsSettings;
+	// Índice para consultas por ID, raridade, estado e posição (UItemRegistrySubsystem)
+	UPROPERTY(Transient)
+	TObjectPtr<UItemRegistrySubsystem> ItemRegistry;
 
-	// Estados internos
-	TArray<ACharacter*> OverlappingPlayers;
-	TMap<ACharacter*, float> PlayerCooldowns; // Mapa de players e seus tempos de cooldown
-	float OverlapCooldownTime = 5.0f; // Tempo de cooldown em segundos
-	FVector OriginalLocation;
-	FRotator OriginalRotation;
-	FRotator CurrentRotation;
-	float CurrentFloatingHeight = 0.0f;
-	bool bIsFloating = false;
-	bool bIsRotating = false;
-	bool bIsResettingRotation = false;
-	bool bIsLightOn = false;
-	FVector WidgetInstructionWorldLocation; // Posição fixa do widget no mundo
+	int32 ItemRegistryHandle = INDEX_NONE;
+
+	// Cooldowns de overlap por player (UItemCooldownSubsystem)
+	UPROPERTY(Transient)
+	TObjectPtr<UItemCooldownSubsystem> Cooldowns;
+
+	uint32 CooldownGeneration = 0; // Incrementado ao ir para o pool; invalida os cooldowns anteriores
+
+	// Detector de repouso e trocas de simulação em lote (UItemPhysicsSubsystem)
+	UPROPERTY(Transient)
+	TObjectPtr<UItemPhysicsSubsystem> Physics;
+
+	int32 SettleIndex = INDEX_NONE; // Entrada no detector de repouso
+	int32 PendingPhysicsToggle = INDEX_NONE; // Troca de simulação aguardando o lote do frame
+	bool bPhysicsResting = false; // Assentado: kinematic e query-only até um impulso externo
+
+	// Lista replicada da célula (UItemWorldListSubsystem): o ator deixa de replicar enquanto estiver nela
+	UPROPERTY(Transient)
+	TObjectPtr<UItemWorldListSubsystem> WorldList;
+
+	UPROPERTY(Transient)
+	TObjectPtr<AItemWorldListActor> WorldListActor;
+
+	int32 WorldListIndex = INDEX_NONE; // Entrada no FItemWorldList do WorldListActor
+
+	bool bIsInPool = false; // Desativado e guardado no UItemPoolSubsystem
+	bool bPickupPredicted = false; // Cliente: escondido aguardando a resposta do pickup (UItemPickupComponent)
+	bool bMeshLoadPending = false; // Placeholder visível até o mesh de STModel chegar
+
+	// Renderização instanciada (UItemInstancedRenderSubsystem)
+	UPROPERTY(Transient)
+	TObjectPtr<UStaticMesh> InstancedMesh;
+
+	int32 InstanceIndex = INDEX_NONE; // Índice da instância no HISM do mesh
+
+	// Registra no ItemManager e inicializa o estado de runtime (BeginPlay e saída do pool)
+	void ActivateItem();
 
 	// Funções de configuração
 	void SetupMesh();
+	void ShowPlaceholderMesh();
+	void ApplyLoadedMesh(UObject* LoadedObject);
+	FSoftObjectPath GetDefinitionMeshPath() const;
+	UStaticMeshComponent* GetOrCreateStaticMeshComponent();
+	USkeletalMeshComponent* GetOrCreateSkeletalMeshComponent();
+	void SetMeshRoot(UPrimitiveComponent* NewRoot);
 	void SetupCollision();
-	void SetupCollisionSphere();
+	void SetupInteractionRange();
 	void SetupLight();
-	void SetupWidgets();
-	void UpdateCollisionSphereSize();
+	void UpdateInteractionRadius();
 
-	// Funções de comportamento
-	void UpdateFloating(float DeltaTime);
-	void UpdateRotation(float DeltaTime);
-	void UpdateLight();
-	void UpdateWidgets();
+	// Funções de comportamento (chamadas pelo UItemManagerSubsystem)
+	// Retorna falso quando o item está em repouso e pode dormir
+	bool UpdateItem(float DeltaTime, FItemRuntimeState& State);
+	void UpdateFloating(float DeltaTime, FItemRuntimeState& State);
+	void UpdateRotation(float DeltaTime, FItemRuntimeState& State);
+	void UpdateLight(FItemRuntimeState& State);
 
-	// Overlap Events
-	UFUNCTION()
-	void OnCollisionSphereBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+	// Caminho em lote (FItemHoverKernel): verdadeiro quando o item está no caso estável do modo cosmético
+	// (proxy ativo, efeitos ligados); já atualiza a luz, flutuação e rotação ficam com o kernel
+	bool PrepareHoverKernel(FItemRuntimeState& State);
+
+	// Orçamento de luzes (UItemLightSubsystem): spotlight real ou fallback emissivo
+	void SetLightActive(bool bActive);
+	void SetEmissiveFallback(bool bEnabled);
+	USpotLightComponent* GetOrCreateSpotLight();
+	void ReleaseLight();
+
+	// Modo cosmético (andromeda.Items.CosmeticHover): o proxy flutua e gira no lugar do root
+	void BeginVisualHover(FItemRuntimeState& State);
+	void EndVisualHover();
+	bool ReturnVisualToRest(float DeltaTime, FItemRuntimeState& State);
+	void ApplyVisualTransform(const FItemRuntimeState& State);
+	void SyncVisualProxy();
+	UPrimitiveComponent* GetOrCreateVisualProxy();
+	bool IsVisualProxyActive() const;
+
+	// Eventos de proximidade (disparados pelo UItemProximitySubsystem)
+	void OnProximityBegin(ACharacter* Character);
+	void OnProximityEnd(ACharacter* Character);
+	void OnRootTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	// Cooldowns: chamado pelo UItemCooldownSubsystem quando um cooldown deste item vence
+	void OnOverlapCooldownExpired();
+
+	// Repouso: item assentado (UItemPhysicsSubsystem) vira instância e entra em dormência de rede (ou na lista replicada)
+	// Volta a ser ator completo e acordado na rede quando um player se aproxima
+	void OnFellAsleep();
+	void OnWokeUp();
+	void CheckSettled();
+	void PromoteFromInstance();
+	void SetNetDormant(bool bDormant);
+
+	// Definição
+	bool ResolveDefinition();
 
 	UFUNCTION()
-	void OnCollisionSphereEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
+	void OnRep_ID();
 
-	// Validação
-	void ValidateItemData();
+	// Validação: falso quando a definição é inválida e o item foi descartado
+	bool ValidateItemData();
+	void DiscardInvalidItem();
 	FLinearColor GetRarityColor() const;
 
 	// Replicação
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 public:
+	// Configura o item a partir de uma definição (chamar antes de FinishSpawning)
+	void InitializeItem(UItemDefinition* InDefinition, int32 InQuantity);
+
+	// Pool (UItemPoolSubsystem)
+	void DeactivateForPool();
+	void ActivateFromPool(UItemDefinition* InDefinition, int32 InQuantity, const FTransform& SpawnTransform);
+	FORCEINLINE bool IsInPool() const { return bIsInPool; }
+	FORCEINLINE bool IsInstanced() const { return InstanceIndex != INDEX_NONE; }
+	FORCEINLINE bool IsInWorldList() const { return WorldListActor != nullptr; }
+
+	// Pickup pelo UItemPickupComponent do controller do Picker (0 = pilha inteira)
+	// No cliente o item some na hora (predição) e volta se o servidor rejeitar ou só dividir a pilha
+	UFUNCTION(BlueprintCallable, Category = "Item|Pickup")
+	bool RequestPickup(ACharacter* Picker, int32 RequestedQuantity = 0);
+
+	// Servidor: concede até RequestedQuantity e remove o item quando a pilha esvazia; retorna a quantidade concedida
+	int32 ServerTryPickup(ACharacter* Picker, int32 RequestedQuantity, bool& bOutRemoved);
+
+	void SetPickupPredicted(bool bPredicted);
+	FORCEINLINE bool IsPickupPredicted() const { return bPickupPredicted; }
+
+	// Servidor: altera a quantidade e envia a atualização mesmo com o item dormente na rede
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "Item")
+	void SetQuantity(int32 NewQuantity);
+
+	// Chamado pelo UItemMeshLoaderSubsystem quando o mesh de STModel termina de carregar
+	void OnMeshLoaded(const FSoftObjectPath& MeshPath, UObject* LoadedObject);
+
+	// Única forma de tirar um item assentado do repouso kinematic: volta a simular e recebe o impulso
+	UFUNCTION(BlueprintCallable, Category = "Item|Physics")
+	void ApplyExternalImpulse(FVector Impulse, bool bVelocityChange = false);
+
+	// EasyMode deve ser alterado por aqui para acordar o item
+	UFUNCTION(BlueprintCallable, Category = "WorldView")
+	void SetEasyMode(bool bEnabled);
+
 	// Getters
 	FORCEINLINE UStaticMeshComponent* GetStaticMeshComponent() const { return StaticMeshComponent; }
 	FORCEINLINE USkeletalMeshComponent* GetSkeletalMeshComponent() const { return SkeletalMeshComponent; }
-	FORCEINLINE USphereComponent* GetCollisionSphere() const { return CollisionSphere; }
+	FORCEINLINE float GetInteractionRadius() const { return InteractionRadius; }
 	FORCEINLINE USpotLightComponent* GetSpotLight() const { return SpotLight; }
+	FORCEINLINE UItemDefinition* GetDefinition() const { return Definition; }
+	FORCEINLINE FName GetItemID() const { return ID; }
+	FORCEINLINE int32 GetQuantity() const { return Quantity; }
+	FORCEINLINE FVector GetWidgetInstructionWorldLocation() const { return WidgetInstructionWorldLocation; }
 };
@@ -0,0 +1,11 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // DataAsset: ItemDefinition
+
+#include "ItemDefinition.h"
+
+const FPrimaryAssetType UItemDefinition::PrimaryAssetType(TEXT("ItemDefinition"));
+
+FPrimaryAssetId UItemDefinition::GetPrimaryAssetId() const
+{
+	// Sem ID configurado, cair no nome do asset para não quebrar o scan do Asset Manager
+	return FPrimaryAssetId(PrimaryAssetType, ID.IsNone() ? GetFName() : ID);
+}
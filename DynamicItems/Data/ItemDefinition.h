@@ -0,0 +1,60 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // DataAsset: ItemDefinition
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "AndromedaSystemsC/DynamicItems/Structure/ItemStructures.h"
+#include "ItemDefinition.generated.h"
+
+/**
+ * Definição imutável de um tipo de item, compartilhada por todas as instâncias com o mesmo ID
+ * Os AMasterItem guardam apenas o ID, um ponteiro para a definição e o estado mutável (Quantity, flags)
+ * Requer "ItemDefinition" em PrimaryAssetTypesToScan do Asset Manager
+ */
+UCLASS(BlueprintType)
+class ANDROMEDA_API UItemDefinition : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	static const FPrimaryAssetType PrimaryAssetType;
+
+	// A definição é indexada pelo ID do item, não pelo nome do asset
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+
+	// Dados do Item
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item")
+	FName ID;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item")
+	FString Name;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item")
+	FSTModel STModel;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item")
+	FSTQty STQty;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item")
+	FSTInfos STInfos;
+
+	// WorldView Settings
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "WorldView")
+	FBasicInfos BasicInfos;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "WorldView")
+	FFloatingSettings FloatingSettings;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "WorldView")
+	FRotationSettings RotationSettings;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "WorldView")
+	FLightSettings LightSettings;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "WorldView")
+	FCollisionSphereSettings CollisionSphereSettings;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "WorldView")
+	FWidgetsSettings WidgetsSettings;
+};
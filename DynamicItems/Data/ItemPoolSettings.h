@@ -0,0 +1,31 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Settings: ItemPool
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "ItemPoolSettings.generated.h"
+
+class AMasterItem;
+
+/**
+ * Configuração do pool de atores de item (Project Settings > Game > Andromeda Item Pool)
+ */
+UCLASS(Config = Game, DefaultConfig, meta = (DisplayName = "Andromeda Item Pool"))
+class ANDROMEDA_API UItemPoolSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	// Classe usada quando o pool precisa spawnar um novo item
+	UPROPERTY(Config, EditAnywhere, Category = "Pool")
+	TSoftClassPtr<AMasterItem> ItemActorClass;
+
+	// Quantidade de atores pré-criados por ID de item no início do mundo
+	UPROPERTY(Config, EditAnywhere, Category = "Pool")
+	TMap<FName, int32> PrewarmCounts;
+
+	// Acima deste limite, itens devolvidos ao pool são destruídos
+	UPROPERTY(Config, EditAnywhere, Category = "Pool", meta = (ClampMin = "0"))
+	int32 MaxPooledPerType = 256;
+};
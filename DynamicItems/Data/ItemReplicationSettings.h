@@ -0,0 +1,40 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Settings: ItemReplication
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "ItemReplicationSettings.generated.h"
+
+/**
+ * Configuração do UAndromedaReplicationGraph (Project Settings > Game > Andromeda Item Replication)
+ */
+UCLASS(Config = Game, DefaultConfig, meta = (DisplayName = "Andromeda Item Replication"))
+class ANDROMEDA_API UItemReplicationSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	// Tamanho da célula da grade de itens; cada conexão só coleta as células ao redor do viewer
+	UPROPERTY(Config, EditAnywhere, Category = "Items", meta = (ClampMin = "500"))
+	float ItemGridCellSize = 5000.0f;
+
+	// Itens além desta distância do viewer não são replicados
+	UPROPERTY(Config, EditAnywhere, Category = "Items", meta = (ClampMin = "0"))
+	float ItemCullDistance = 6000.0f;
+
+	// Itens acordados são avaliados a cada N frames de replicação
+	UPROPERTY(Config, EditAnywhere, Category = "Items", meta = (ClampMin = "1", ClampMax = "255"))
+	int32 ItemReplicationPeriodFrame = 2;
+
+	// Grade dos demais atores espacializados (pawns, projéteis, etc.)
+	UPROPERTY(Config, EditAnywhere, Category = "Default", meta = (ClampMin = "500"))
+	float DefaultGridCellSize = 10000.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Default", meta = (ClampMin = "0"))
+	float DefaultCullDistance = 15000.0f;
+
+	// Deslocamento da origem das grades (metade da extensão do mapa)
+	UPROPERTY(Config, EditAnywhere, Category = "Default")
+	float GridSpatialBias = 200000.0f;
+};
@@ -0,0 +1,328 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Diagnostics: ItemTrace
+
+#include "ItemTrace.h"
+#include "AndromedaSystemsC/DynamicItems/Core/MasterItem.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/ThreadManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/UObjectArray.h"
+#include <atomic>
+
+static constexpr uint32 ItemTraceMagic = 0x43525449; // "ITRC"
+static constexpr uint32 ItemTraceVersion = 1;
+
+bool FItemTrace::bEnabled = false;
+uint64 FItemTrace::CaptureStartCycles = 0;
+
+// Acesso ao estado privado do FItemTrace (bool lido direto pelo macro, sem passar pelo console manager)
+struct FItemTraceConsole
+{
+	static FAutoConsoleVariableRef EnabledVariable;
+};
+
+FAutoConsoleVariableRef FItemTraceConsole::EnabledVariable(
+	TEXT("andromeda.Items.Trace"),
+	FItemTrace::bEnabled,
+	TEXT("Se verdadeiro, eventos de itens (overlap, cooldown, flutuação/rotação, física, mesh, validação) são gravados nos ring buffers por thread.\n")
+	TEXT("Ligar inicia uma nova captura; grave com Andromeda.Items.TraceDump."),
+	FConsoleVariableDelegate::CreateStatic(&FItemTrace::OnEnabledChanged),
+	ECVF_Default);
+
+/**
+ * Ring buffer de uma thread: só a dona escreve; o contador é publicado com release depois do registro
+ * Nunca é liberado (um por thread que já gravou), a lista global só cresce
+ */
+struct FItemTraceBuffer
+{
+	FItemTraceRecord Records[FItemTrace::BufferCapacity];
+	std::atomic<uint64> WriteCount{0};
+	uint32 ThreadId = 0;
+	FItemTraceBuffer* Next = nullptr;
+};
+
+static std::atomic<FItemTraceBuffer*> GItemTraceBuffers{nullptr};
+static thread_local FItemTraceBuffer* GItemTraceThreadBuffer = nullptr;
+
+static FItemTraceBuffer* CreateThreadBuffer()
+{
+	FItemTraceBuffer* Buffer = new FItemTraceBuffer();
+	Buffer->ThreadId = FPlatformTLS::GetCurrentThreadId();
+
+	// Inserção sem lock no início da lista
+	FItemTraceBuffer* Head = GItemTraceBuffers.load(std::memory_order_relaxed);
+	do
+	{
+		Buffer->Next = Head;
+	}
+	while (!GItemTraceBuffers.compare_exchange_weak(Head, Buffer, std::memory_order_release, std::memory_order_relaxed));
+
+	GItemTraceThreadBuffer = Buffer;
+	return Buffer;
+}
+
+void FItemTrace::Record(EItemTraceEvent Event, const UObject* Object, uint16 Payload)
+{
+	FItemTraceBuffer* Buffer = GItemTraceThreadBuffer;
+	if (UNLIKELY(!Buffer))
+	{
+		Buffer = CreateThreadBuffer();
+	}
+
+	const uint64 WriteCount = Buffer->WriteCount.load(std::memory_order_relaxed);
+	FItemTraceRecord& Entry = Buffer->Records[WriteCount & (BufferCapacity - 1)];
+	Entry.Cycles = FPlatformTime::Cycles64();
+	Entry.ObjectIndex = Object ? static_cast<uint32>(GUObjectArray.ObjectToIndex(Object)) : MAX_uint32;
+	Entry.Payload = Payload;
+	Entry.Event = Event;
+	Buffer->WriteCount.store(WriteCount + 1, std::memory_order_release);
+}
+
+void FItemTrace::OnEnabledChanged(IConsoleVariable* Variable)
+{
+	if (bEnabled)
+	{
+		CaptureStartCycles = FPlatformTime::Cycles64();
+	}
+}
+
+const TCHAR* FItemTrace::GetEventName(EItemTraceEvent Event)
+{
+	switch (Event)
+	{
+	case EItemTraceEvent::OverlapBegin:		return TEXT("OverlapBegin");
+	case EItemTraceEvent::OverlapEnd:		return TEXT("OverlapEnd");
+	case EItemTraceEvent::CooldownStart:	return TEXT("CooldownStart");
+	case EItemTraceEvent::CooldownExpire:	return TEXT("CooldownExpire");
+	case EItemTraceEvent::FloatStart:		return TEXT("FloatStart");
+	case EItemTraceEvent::FloatStop:		return TEXT("FloatStop");
+	case EItemTraceEvent::RotateStart:		return TEXT("RotateStart");
+	case EItemTraceEvent::RotateStop:		return TEXT("RotateStop");
+	case EItemTraceEvent::RotateReset:		return TEXT("RotateReset");
+	case EItemTraceEvent::PhysicsToggle:	return TEXT("PhysicsToggle");
+	case EItemTraceEvent::MeshLoadStart:	return TEXT("MeshLoadStart");
+	case EItemTraceEvent::MeshLoadFinish:	return TEXT("MeshLoadFinish");
+	case EItemTraceEvent::ValidationFailed:	return TEXT("ValidationFailed");
+	default:								return TEXT("Unknown");
+	}
+}
+
+void FItemTrace::Serialize(FArchive& Ar, FFile& File)
+{
+	uint32 Magic = ItemTraceMagic;
+	uint32 Version = ItemTraceVersion;
+	Ar << Magic << Version;
+	if (Ar.IsLoading() && (Magic != ItemTraceMagic || Version != ItemTraceVersion))
+	{
+		Ar.SetError();
+		return;
+	}
+
+	Ar << File.SecondsPerCycle;
+
+	int32 NumObjects = File.Objects.Num();
+	Ar << NumObjects;
+	if (Ar.IsLoading())
+	{
+		File.Objects.SetNum(FMath::Max(0, NumObjects));
+	}
+	for (FObjectInfo& Object : File.Objects)
+	{
+		Ar << Object.ObjectIndex << Object.Name << Object.ItemID;
+	}
+
+	int32 NumThreads = File.Threads.Num();
+	Ar << NumThreads;
+	if (Ar.IsLoading())
+	{
+		File.Threads.SetNum(FMath::Max(0, NumThreads));
+	}
+	for (FThreadTrace& Thread : File.Threads)
+	{
+		int32 NumRecords = Thread.Records.Num();
+		Ar << Thread.ThreadId << Thread.ThreadName << NumRecords;
+		if (Ar.IsLoading())
+		{
+			if (NumRecords < 0 || static_cast<int64>(NumRecords) * sizeof(FItemTraceRecord) > Ar.TotalSize() - Ar.Tell())
+			{
+				Ar.SetError();
+				return;
+			}
+			Thread.Records.SetNumUninitialized(NumRecords);
+		}
+		// Registros gravados em bloco, na ordem de bytes da máquina que gravou
+		Ar.Serialize(Thread.Records.GetData(), NumRecords * sizeof(FItemTraceRecord));
+	}
+}
+
+bool FItemTrace::Dump(FString& InOutFileName)
+{
+	check(IsInGameThread());
+
+	FFile File;
+	File.SecondsPerCycle = FPlatformTime::GetSecondsPerCycle64();
+
+	TSet<uint32> ObjectIndices;
+	for (FItemTraceBuffer* Buffer = GItemTraceBuffers.load(std::memory_order_acquire); Buffer; Buffer = Buffer->Next)
+	{
+		const uint64 EndCount = Buffer->WriteCount.load(std::memory_order_acquire);
+		const uint64 StartCount = EndCount > BufferCapacity ? EndCount - BufferCapacity : 0;
+
+		TArray<FItemTraceRecord> Records;
+		Records.Reserve(static_cast<int32>(EndCount - StartCount));
+		for (uint64 Count = StartCount; Count < EndCount; ++Count)
+		{
+			Records.Add(Buffer->Records[Count & (BufferCapacity - 1)]);
+		}
+
+		// A thread continuou gravando durante a cópia: descartar o que pode ter sido sobrescrito
+		const uint64 CountAfterCopy = Buffer->WriteCount.load(std::memory_order_acquire);
+		const uint64 FirstSafeCount = CountAfterCopy > BufferCapacity ? CountAfterCopy - BufferCapacity : 0;
+		if (FirstSafeCount > StartCount)
+		{
+			Records.RemoveAt(0, static_cast<int32>(FMath::Min(FirstSafeCount - StartCount, static_cast<uint64>(Records.Num()))), false);
+		}
+
+		Records.RemoveAll([](const FItemTraceRecord& Entry) { return Entry.Cycles < CaptureStartCycles; });
+		if (Records.Num() == 0)
+		{
+			continue;
+		}
+
+		FThreadTrace& Thread = File.Threads.AddDefaulted_GetRef();
+		Thread.ThreadId = Buffer->ThreadId;
+		Thread.ThreadName = FThreadManager::GetThreadName(Buffer->ThreadId);
+		for (const FItemTraceRecord& Entry : Records)
+		{
+			ObjectIndices.Add(Entry.ObjectIndex);
+		}
+		Thread.Records = MoveTemp(Records);
+	}
+
+	// Índices resolvidos no momento do dump: um objeto já coletado pode ter cedido o índice a outro
+	for (const uint32 ObjectIndex : ObjectIndices)
+	{
+		const FUObjectItem* ObjectItem = ObjectIndex != MAX_uint32 ? GUObjectArray.IndexToObject(static_cast<int32>(ObjectIndex)) : nullptr;
+		const UObject* Object = ObjectItem ? static_cast<const UObject*>(ObjectItem->Object) : nullptr;
+		if (!Object)
+		{
+			continue;
+		}
+
+		FObjectInfo& Info = File.Objects.AddDefaulted_GetRef();
+		Info.ObjectIndex = ObjectIndex;
+		Info.Name = Object->GetName();
+		if (const AMasterItem* Item = Cast<AMasterItem>(Object))
+		{
+			Info.ItemID = Item->GetItemID().ToString();
+		}
+	}
+
+	if (InOutFileName.IsEmpty())
+	{
+		InOutFileName = FPaths::ProfilingDir() / TEXT("ItemTrace") / FString::Printf(TEXT("ItemTrace_%s.itrace"), *FDateTime::Now().ToString());
+	}
+
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	Serialize(Writer, File);
+	return FFileHelper::SaveArrayToFile(Data, *InOutFileName);
+}
+
+bool FItemTrace::LoadFile(const FString& FileName, FFile& OutFile)
+{
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *FileName))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Data);
+	Serialize(Reader, OutFile);
+	return !Reader.IsError();
+}
+
+static FAutoConsoleCommandWithArgs GItemTraceDumpCommand(
+	TEXT("Andromeda.Items.TraceDump"),
+	TEXT("Andromeda.Items.TraceDump [Arquivo] - Grava os ring buffers de andromeda.Items.Trace em um arquivo .itrace"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		FString FileName = Args.Num() > 0 ? Args[0] : FString();
+		if (FItemTrace::Dump(FileName))
+		{
+			UE_LOG(LogTemp, Log, TEXT("FItemTrace: captura gravada em %s (resuma com -run=ItemTraceSummary -File=<arquivo>)"), *FileName);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("FItemTrace: falha ao gravar %s"), *FileName);
+		}
+	}));
+
+// Custo por evento: desligado (só o teste do macro), ligado em uma thread e ligado em todas as workers ao mesmo tempo
+struct FItemTraceBenchmark
+{
+	static void Run(int32 Count)
+	{
+		// Os eventos sintéticos passam pelos mesmos ring buffers e sobrescreveriam uma captura real
+		if (FItemTrace::bEnabled)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("FItemTrace: captura em andamento; desligue andromeda.Items.Trace (ou grave com Andromeda.Items.TraceDump) antes do benchmark"));
+			return;
+		}
+
+		const UObject* Object = GetTransientPackage();
+
+		FItemTrace::bEnabled = false;
+		uint64 StartCycles = FPlatformTime::Cycles64();
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			ITEM_TRACE(OverlapBegin, Object, Index);
+		}
+		const double DisabledNs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000000.0 / Count;
+
+		FItemTrace::bEnabled = true;
+		StartCycles = FPlatformTime::Cycles64();
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			ITEM_TRACE(OverlapBegin, Object, Index);
+		}
+		const double EnabledNs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000000.0 / Count;
+
+		const int32 NumTasks = FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads());
+		const int32 CountPerTask = FMath::Max(1, Count / NumTasks);
+		std::atomic<uint64> ParallelCycles{0};
+		ParallelFor(NumTasks, [Object, CountPerTask, &ParallelCycles](int32 TaskIndex)
+		{
+			const uint64 TaskStartCycles = FPlatformTime::Cycles64();
+			for (int32 Index = 0; Index < CountPerTask; ++Index)
+			{
+				ITEM_TRACE(OverlapBegin, Object, Index);
+			}
+			ParallelCycles.fetch_add(FPlatformTime::Cycles64() - TaskStartCycles, std::memory_order_relaxed);
+		});
+		const double ParallelNs = FPlatformTime::ToMilliseconds64(ParallelCycles.load()) * 1000000.0 / (static_cast<double>(CountPerTask) * NumTasks);
+
+		// Os eventos sintéticos não entram na próxima captura
+		FItemTrace::bEnabled = false;
+		FItemTrace::CaptureStartCycles = FPlatformTime::Cycles64();
+
+		UE_LOG(LogTemp, Log, TEXT("FItemTrace: %d eventos, desligado %.2f ns, ligado %.2f ns por evento, %d threads em paralelo %.2f ns por evento"),
+			Count, DisabledNs, EnabledNs, NumTasks, ParallelNs);
+		if (EnabledNs > 50.0 || ParallelNs > 50.0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("FItemTrace: custo por evento acima da meta de 50 ns"));
+		}
+	}
+};
+
+static FAutoConsoleCommandWithArgs GItemTraceBenchmarkCommand(
+	TEXT("Andromeda.Items.TraceBenchmark"),
+	TEXT("Andromeda.Items.TraceBenchmark [Count=1000000] - Mede o custo por evento do FItemTrace (meta: < 50 ns)"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		FItemTraceBenchmark::Run(Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000000);
+	}));
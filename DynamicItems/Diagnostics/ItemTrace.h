@@ -0,0 +1,111 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Diagnostics: ItemTrace
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IConsoleVariable;
+
+// 0 remove as chamadas de ITEM_TRACE da build (o gravador continua existindo para ler arquivos)
+#ifndef ANDROMEDA_ITEM_TRACE
+#define ANDROMEDA_ITEM_TRACE 1
+#endif
+
+enum class EItemTraceEvent : uint8
+{
+	OverlapBegin,
+	OverlapEnd,
+	CooldownStart,		// Payload: duração em ms (saturada em 65535)
+	CooldownExpire,
+	FloatStart,			// Payload: 1 = proxy do modo cosmético, 0 = root
+	FloatStop,
+	RotateStart,
+	RotateStop,
+	RotateReset,
+	PhysicsToggle,		// Payload: 1 = volta a simular, 0 = kinematic
+	MeshLoadStart,
+	MeshLoadFinish,		// Payload: 1 = carregou, 0 = falhou
+	ValidationFailed,	// Payload: EItemTraceValidation
+	Num
+};
+
+enum class EItemTraceValidation : uint16
+{
+	MissingDefinition,
+	EmptyName,
+	QuantityClamped
+};
+
+// 16 bytes, gravado e lido sem conversão
+struct FItemTraceRecord
+{
+	uint64 Cycles = 0;					// FPlatformTime::Cycles64
+	uint32 ObjectIndex = MAX_uint32;	// Índice no GUObjectArray (resolvido para nome no dump)
+	uint16 Payload = 0;
+	EItemTraceEvent Event = EItemTraceEvent::Num;
+	uint8 Reserved = 0;
+};
+static_assert(sizeof(FItemTraceRecord) == 16, "FItemTraceRecord deve ter 16 bytes");
+
+/**
+ * Gravador binário de eventos de itens para diagnóstico em produção (andromeda.Items.Trace)
+ * Um ring buffer por thread, sem lock: cada thread só escreve no próprio buffer e o dump lê com o contador atômico
+ * Andromeda.Items.TraceDump grava um arquivo .itrace; o UItemTraceSummaryCommandlet resume o arquivo offline
+ */
+class ANDROMEDA_API FItemTrace
+{
+public:
+	// Eventos por thread; os mais antigos são sobrescritos (potência de 2)
+	static constexpr uint32 BufferCapacity = 1 << 14;
+
+	FORCEINLINE static bool IsEnabled() { return bEnabled; }
+
+	static void Record(EItemTraceEvent Event, const UObject* Object, uint16 Payload);
+
+	// Game thread: copia os buffers de todas as threads e grava o arquivo (caminho vazio = Saved/Profiling/ItemTrace)
+	static bool Dump(FString& InOutFileName);
+
+	// Arquivo .itrace carregado (dump e ferramenta offline usam a mesma serialização)
+	struct FThreadTrace
+	{
+		uint32 ThreadId = 0;
+		FString ThreadName;
+		TArray<FItemTraceRecord> Records;
+	};
+
+	struct FObjectInfo
+	{
+		uint32 ObjectIndex = MAX_uint32;
+		FString Name;
+		FString ItemID;
+	};
+
+	struct FFile
+	{
+		double SecondsPerCycle = 0.0;
+		TArray<FObjectInfo> Objects;
+		TArray<FThreadTrace> Threads;
+	};
+
+	static bool LoadFile(const FString& FileName, FFile& OutFile);
+	static void Serialize(FArchive& Ar, FFile& File);
+	static const TCHAR* GetEventName(EItemTraceEvent Event);
+
+private:
+	static void OnEnabledChanged(IConsoleVariable* Variable);
+
+	static bool bEnabled;
+
+	// Eventos anteriores não entram no dump (ligar o trace de novo começa uma nova captura)
+	static uint64 CaptureStartCycles;
+
+	friend struct FItemTraceConsole;
+	friend struct FItemTraceBenchmark;
+};
+
+#if ANDROMEDA_ITEM_TRACE
+#define ITEM_TRACE(EventName, Object, Payload) \
+	do { if (FItemTrace::IsEnabled()) { FItemTrace::Record(EItemTraceEvent::EventName, Object, static_cast<uint16>(Payload)); } } while (0)
+#else
+#define ITEM_TRACE(EventName, Object, Payload)
+#endif
@@ -0,0 +1,169 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Diagnostics: ItemTraceSummaryCommandlet
+
+#include "ItemTraceSummaryCommandlet.h"
+#include "AndromedaSystemsC/DynamicItems/Diagnostics/ItemTrace.h"
+#include "Misc/Parse.h"
+
+UItemTraceSummaryCommandlet::UItemTraceSummaryCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UItemTraceSummaryCommandlet::Main(const FString& Params)
+{
+	FString FileName;
+	if (!FParse::Value(*Params, TEXT("File="), FileName))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UItemTraceSummaryCommandlet: uso -run=ItemTraceSummary -File=<arquivo.itrace> [-Top=10] [-ThrashMs=500]"));
+		return 1;
+	}
+
+	int32 TopCount = 10;
+	float ThrashMs = 500.0f;
+	FParse::Value(*Params, TEXT("Top="), TopCount);
+	FParse::Value(*Params, TEXT("ThrashMs="), ThrashMs);
+
+	FItemTrace::FFile File;
+	if (!FItemTrace::LoadFile(FileName, File))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UItemTraceSummaryCommandlet: arquivo inválido ou ilegível '%s'"), *FileName);
+		return 1;
+	}
+
+	// Todas as threads em uma única linha do tempo
+	TArray<FItemTraceRecord> Records;
+	UE_LOG(LogTemp, Display, TEXT("Threads:"));
+	for (const FItemTrace::FThreadTrace& Thread : File.Threads)
+	{
+		UE_LOG(LogTemp, Display, TEXT("  %-24s (%u): %d eventos"), *Thread.ThreadName, Thread.ThreadId, Thread.Records.Num());
+		Records.Append(Thread.Records);
+	}
+
+	if (Records.Num() == 0)
+	{
+		UE_LOG(LogTemp, Display, TEXT("UItemTraceSummaryCommandlet: captura vazia"));
+		return 0;
+	}
+
+	Records.Sort([](const FItemTraceRecord& A, const FItemTraceRecord& B) { return A.Cycles < B.Cycles; });
+	const uint64 FirstCycles = Records[0].Cycles;
+	const double DurationSeconds = FMath::Max((Records.Last().Cycles - FirstCycles) * File.SecondsPerCycle, 0.001);
+
+	struct FObjectSummary
+	{
+		int32 Counts[static_cast<int32>(EItemTraceEvent::Num)] = {};
+		int32 Total = 0;
+		int32 CooldownThrash = 0; // Novo cooldown pouco depois do anterior vencer
+		int32 MaxOverlapsPerSecond = 0;
+		uint64 LastCooldownExpireCycles = 0;
+		TArray<uint64> OverlapBeginCycles;
+	};
+
+	const uint64 ThrashCycles = static_cast<uint64>(ThrashMs / 1000.0 / File.SecondsPerCycle);
+	const uint64 SecondCycles = static_cast<uint64>(1.0 / File.SecondsPerCycle);
+
+	int32 EventCounts[static_cast<int32>(EItemTraceEvent::Num)] = {};
+	int32 ValidationCounts[3] = {};
+	TMap<uint32, FObjectSummary> Objects;
+	for (const FItemTraceRecord& Entry : Records)
+	{
+		const int32 EventIndex = static_cast<int32>(Entry.Event);
+		if (EventIndex >= static_cast<int32>(EItemTraceEvent::Num))
+		{
+			continue;
+		}
+		++EventCounts[EventIndex];
+
+		FObjectSummary& Object = Objects.FindOrAdd(Entry.ObjectIndex);
+		++Object.Counts[EventIndex];
+		++Object.Total;
+
+		switch (Entry.Event)
+		{
+		case EItemTraceEvent::OverlapBegin:
+			Object.OverlapBeginCycles.Add(Entry.Cycles);
+			break;
+		case EItemTraceEvent::CooldownExpire:
+			Object.LastCooldownExpireCycles = Entry.Cycles;
+			break;
+		case EItemTraceEvent::CooldownStart:
+			if (Object.LastCooldownExpireCycles != 0 && Entry.Cycles - Object.LastCooldownExpireCycles <= ThrashCycles)
+			{
+				++Object.CooldownThrash;
+			}
+			break;
+		case EItemTraceEvent::ValidationFailed:
+			if (Entry.Payload < UE_ARRAY_COUNT(ValidationCounts))
+			{
+				++ValidationCounts[Entry.Payload];
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	// Flood: maior número de entradas de overlap do mesmo item dentro de qualquer janela de 1 s
+	for (TPair<uint32, FObjectSummary>& Pair : Objects)
+	{
+		const TArray<uint64>& Cycles = Pair.Value.OverlapBeginCycles;
+		int32 WindowStart = 0;
+		for (int32 Index = 0; Index < Cycles.Num(); ++Index)
+		{
+			while (Cycles[Index] - Cycles[WindowStart] > SecondCycles)
+			{
+				++WindowStart;
+			}
+			Pair.Value.MaxOverlapsPerSecond = FMath::Max(Pair.Value.MaxOverlapsPerSecond, Index - WindowStart + 1);
+		}
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Captura: %.3f s, %d eventos, %d threads, %d objetos"), DurationSeconds, Records.Num(), File.Threads.Num(), Objects.Num());
+	UE_LOG(LogTemp, Display, TEXT("Eventos:"));
+	for (int32 EventIndex = 0; EventIndex < static_cast<int32>(EItemTraceEvent::Num); ++EventIndex)
+	{
+		if (EventCounts[EventIndex] > 0)
+		{
+			UE_LOG(LogTemp, Display, TEXT("  %-18s %8d (%.1f/s)"),
+				FItemTrace::GetEventName(static_cast<EItemTraceEvent>(EventIndex)), EventCounts[EventIndex], EventCounts[EventIndex] / DurationSeconds);
+		}
+	}
+
+	if (EventCounts[static_cast<int32>(EItemTraceEvent::ValidationFailed)] > 0)
+	{
+		UE_LOG(LogTemp, Display, TEXT("Validação: %d sem definição, %d sem nome, %d quantidade corrigida"),
+			ValidationCounts[0], ValidationCounts[1], ValidationCounts[2]);
+	}
+
+	TMap<uint32, const FItemTrace::FObjectInfo*> ObjectInfos;
+	for (const FItemTrace::FObjectInfo& Info : File.Objects)
+	{
+		ObjectInfos.Add(Info.ObjectIndex, &Info);
+	}
+
+	Objects.ValueSort([](const FObjectSummary& A, const FObjectSummary& B) { return A.Total > B.Total; });
+	UE_LOG(LogTemp, Display, TEXT("Itens com mais eventos (overlap/s máx, thrash de cooldown em %.0f ms, trocas de física):"), ThrashMs);
+	int32 NumListed = 0;
+	for (const TPair<uint32, FObjectSummary>& Pair : Objects)
+	{
+		if (NumListed++ >= TopCount)
+		{
+			break;
+		}
+
+		const FItemTrace::FObjectInfo* const* Info = ObjectInfos.Find(Pair.Key);
+		const FObjectSummary& Object = Pair.Value;
+		UE_LOG(LogTemp, Display, TEXT("  %-32s %-16s %6d eventos, %4d overlap/s, %4d thrash, %4d física"),
+			Info ? *(*Info)->Name : *FString::Printf(TEXT("#%u"), Pair.Key),
+			Info ? *(*Info)->ItemID : TEXT("-"),
+			Object.Total,
+			Object.MaxOverlapsPerSecond,
+			Object.CooldownThrash,
+			Object.Counts[static_cast<int32>(EItemTraceEvent::PhysicsToggle)]);
+	}
+
+	return 0;
+}
@@ -0,0 +1,23 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Diagnostics: ItemTraceSummaryCommandlet
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ItemTraceSummaryCommandlet.generated.h"
+
+/**
+ * Resumo offline de um arquivo .itrace (Andromeda.Items.TraceDump)
+ * UnrealEditor-Cmd <Projeto> -run=ItemTraceSummary -File=<arquivo.itrace> [-Top=10] [-ThrashMs=500]
+ * Contagem por evento e por thread, itens com mais eventos, floods de overlap, thrash de cooldown e trocas de física
+ */
+UCLASS()
+class ANDROMEDA_API UItemTraceSummaryCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UItemTraceSummaryCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
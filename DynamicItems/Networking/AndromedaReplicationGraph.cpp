@@ -0,0 +1,170 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // ReplicationGraph: Andromeda
+
+#include "AndromedaReplicationGraph.h"
+#include "AndromedaSystemsC/DynamicItems/Core/MasterItem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/ItemStats.h"
+#include "AndromedaSystemsC/DynamicItems/Data/ItemReplicationSettings.h"
+#include "AndromedaSystemsC/DynamicItems/Networking/ItemWorldListActor.h"
+#include "Engine/Engine.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("RepGraph Item Gather"), STAT_ItemRepGraphGather, STATGROUP_AndromedaItems);
+
+// Harness: conexões simuladas pelo próprio engine (sem rede real) recebem o mesmo gather de um cliente
+// Rodar em um servidor (listen ou dedicado) com o UAndromedaReplicationGraph ativo
+static FAutoConsoleCommandWithWorldAndArgs GItemRepGraphHarnessCommand(
+	TEXT("Andromeda.Items.RepGraphHarness"),
+	TEXT("Andromeda.Items.RepGraphHarness <Connections> - Adiciona N conexões simuladas e zera as medições de gather"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UAndromedaReplicationGraph* Graph = UAndromedaReplicationGraph::Get(World);
+		if (!Graph)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("UAndromedaReplicationGraph: graph inativo (rode como servidor com ReplicationDriverClassName configurado)"));
+			return;
+		}
+
+		const int32 NumConnections = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 16;
+		GEngine->Exec(World, *FString::Printf(TEXT("net.SimulateConnections %d"), NumConnections));
+		Graph->GetItemGridNode()->ResetGatherStats();
+
+		UE_LOG(LogTemp, Log, TEXT("UAndromedaReplicationGraph: %d conexões simuladas adicionadas; use Andromeda.Items.RepGraphStats após alguns frames"), NumConnections);
+	}));
+
+static FAutoConsoleCommandWithWorld GItemRepGraphStatsCommand(
+	TEXT("Andromeda.Items.RepGraphStats"),
+	TEXT("Mostra o tempo médio de gather da grade de itens por conexão e zera as medições"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UAndromedaReplicationGraph* Graph = UAndromedaReplicationGraph::Get(World))
+		{
+			Graph->GetItemGridNode()->LogGatherStats();
+			Graph->GetItemGridNode()->ResetGatherStats();
+		}
+	}));
+
+void UItemGridReplicationNode::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ItemRepGraphGather);
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	Super::GatherActorListsForConnection(Params);
+	GatherCycles += FPlatformTime::Cycles64() - StartCycles;
+	++NumGathers;
+}
+
+void UItemGridReplicationNode::ResetGatherStats()
+{
+	GatherCycles = 0;
+	NumGathers = 0;
+}
+
+void UItemGridReplicationNode::LogGatherStats() const
+{
+	const double TotalMs = FPlatformTime::ToMilliseconds64(GatherCycles);
+	UE_LOG(LogTemp, Log, TEXT("UItemGridReplicationNode: %d gathers, %.4f ms por conexão (%.3f ms no total)"),
+		NumGathers, NumGathers > 0 ? TotalMs / NumGathers : 0.0, TotalMs);
+}
+
+UAndromedaReplicationGraph* UAndromedaReplicationGraph::Get(const UWorld* World)
+{
+	UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr;
+	return NetDriver ? Cast<UAndromedaReplicationGraph>(NetDriver->GetReplicationDriver()) : nullptr;
+}
+
+void UAndromedaReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	const UItemReplicationSettings* Settings = GetDefault<UItemReplicationSettings>();
+
+	FClassReplicationInfo DefaultInfo;
+	DefaultInfo.SetCullDistanceSquared(FMath::Square(Settings->DefaultCullDistance));
+	GlobalActorReplicationInfoMap.SetClassInfo(AActor::StaticClass(), DefaultInfo);
+
+	// Itens: cull curto e avaliados com menos frequência (quase sempre estão dormentes)
+	FClassReplicationInfo ItemInfo;
+	ItemInfo.SetCullDistanceSquared(FMath::Square(Settings->ItemCullDistance));
+	ItemInfo.ReplicationPeriodFrame = FMath::Clamp(Settings->ItemReplicationPeriodFrame, 1, 255);
+	GlobalActorReplicationInfoMap.SetClassInfo(AMasterItem::StaticClass(), ItemInfo);
+
+	// Listas de célula: ficam no centro da célula, o cull precisa alcançar os itens da borda
+	FClassReplicationInfo WorldListInfo;
+	WorldListInfo.SetCullDistanceSquared(FMath::Square(Settings->ItemCullDistance + Settings->ItemGridCellSize * UE_HALF_SQRT_2));
+	GlobalActorReplicationInfoMap.SetClassInfo(AItemWorldListActor::StaticClass(), WorldListInfo);
+}
+
+void UAndromedaReplicationGraph::InitGlobalGraphNodes()
+{
+	const UItemReplicationSettings* Settings = GetDefault<UItemReplicationSettings>();
+	const FVector2D SpatialBias(-Settings->GridSpatialBias, -Settings->GridSpatialBias);
+
+	ItemGridNode = CreateNewNode<UItemGridReplicationNode>();
+	ItemGridNode->CellSize = Settings->ItemGridCellSize;
+	ItemGridNode->SpatialBias = SpatialBias;
+	AddGlobalGraphNode(ItemGridNode);
+
+	GridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+	GridNode->CellSize = Settings->DefaultGridCellSize;
+	GridNode->SpatialBias = SpatialBias;
+	AddGlobalGraphNode(GridNode);
+
+	AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(AlwaysRelevantNode);
+}
+
+void UAndromedaReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection)
+{
+	Super::InitConnectionGraphNodes(RepGraphConnection);
+
+	// PlayerController, pawn e view target da própria conexão
+	UReplicationGraphNode_AlwaysRelevant_ForConnection* AlwaysRelevantForConnectionNode = CreateNewNode<UReplicationGraphNode_AlwaysRelevant_ForConnection>();
+	AddConnectionGraphNode(AlwaysRelevantForConnectionNode, RepGraphConnection);
+}
+
+void UAndromedaReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	AActor* Actor = ActorInfo.Actor;
+	if (Actor->IsA<AMasterItem>())
+	{
+		// Item em DORM_DormantAll é tratado como estático na grade; volta a ser dinâmico quando acorda
+		ItemGridNode->AddActor_Dormancy(ActorInfo, GlobalInfo);
+	}
+	else if (Actor->IsA<AItemWorldListActor>())
+	{
+		// Lista de célula nunca se move
+		ItemGridNode->AddActor_Static(ActorInfo, GlobalInfo);
+	}
+	else if (Actor->bAlwaysRelevant)
+	{
+		AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+	}
+	else if (!Actor->bOnlyRelevantToOwner)
+	{
+		GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+	}
+	// Atores só relevantes ao dono são coletados pelo nó AlwaysRelevant_ForConnection
+}
+
+void UAndromedaReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	AActor* Actor = ActorInfo.Actor;
+	if (Actor->IsA<AMasterItem>())
+	{
+		ItemGridNode->RemoveActor_Dormancy(ActorInfo);
+	}
+	else if (Actor->IsA<AItemWorldListActor>())
+	{
+		ItemGridNode->RemoveActor_Static(ActorInfo);
+	}
+	else if (Actor->bAlwaysRelevant)
+	{
+		AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+	}
+	else if (!Actor->bOnlyRelevantToOwner)
+	{
+		GridNode->RemoveActor_Dynamic(ActorInfo);
+	}
+}
@@ -0,0 +1,63 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // ReplicationGraph: Andromeda
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "AndromedaReplicationGraph.generated.h"
+
+/**
+ * Grade dedicada aos AMasterItem
+ * Acumula o tempo de gather por conexão para o harness (Andromeda.Items.RepGraphStats)
+ */
+UCLASS()
+class ANDROMEDA_API UItemGridReplicationNode : public UReplicationGraphNode_GridSpatialization2D
+{
+	GENERATED_BODY()
+
+public:
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+	void ResetGatherStats();
+	void LogGatherStats() const;
+
+private:
+	uint64 GatherCycles = 0;
+	int32 NumGathers = 0;
+};
+
+/**
+ * Replication Graph do projeto
+ * Itens ficam em uma grade própria com cull curto; itens dormentes são tratados como estáticos
+ * Ativar em DefaultEngine.ini:
+ * [/Script/OnlineSubsystemUtils.IpNetDriver]
+ * ReplicationDriverClassName="/Script/Andromeda.AndromedaReplicationGraph"
+ */
+UCLASS(Transient)
+class ANDROMEDA_API UAndromedaReplicationGraph : public UReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	// UReplicationGraph
+	virtual void InitGlobalActorClassSettings() override;
+	virtual void InitGlobalGraphNodes() override;
+	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+
+	FORCEINLINE UItemGridReplicationNode* GetItemGridNode() const { return ItemGridNode; }
+
+	// Graph ativo no net driver do mundo (nulo sem rede ou com outro replication driver)
+	static UAndromedaReplicationGraph* Get(const UWorld* World);
+
+private:
+	UPROPERTY()
+	TObjectPtr<UItemGridReplicationNode> ItemGridNode;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_GridSpatialization2D> GridNode;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_ActorList> AlwaysRelevantNode;
+};
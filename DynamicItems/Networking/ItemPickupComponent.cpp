@@ -0,0 +1,254 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Component: ItemPickup
+
+#include "ItemPickupComponent.h"
+#include "AndromedaSystemsC/DynamicItems/Core/MasterItem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/ItemStats.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemRegistrySubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pickup Requests"), STAT_ItemPickupRequests, STATGROUP_AndromedaItems);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pickup RPCs"), STAT_ItemPickupRPCs, STATGROUP_AndromedaItems);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pickup Rollbacks"), STAT_ItemPickupRollbacks, STATGROUP_AndromedaItems);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Last Pickup Confirm (ms)"), STAT_ItemPickupConfirmLatency, STATGROUP_AndromedaItems);
+
+static TAutoConsoleVariable<float> CVarItemPickupSimulatedLatency(
+	TEXT("andromeda.Items.PickupSimulatedLatency"),
+	0.0f,
+	TEXT("Atraso artificial em segundos aplicado a cada perna do pickup (pedido e resposta). Para testar predição e rollback em listen server local."),
+	ECVF_Cheat);
+
+// Pedidos acima disto em um único RPC são rejeitados sem resolver (o cliente envia em blocos deste tamanho)
+static constexpr int32 MaxPickupRequestsPerBatch = 64;
+
+// Pickup do item mais próximo pelo player local; com AllPlayers=1 (servidor) todos os players pedem o mesmo item no mesmo frame
+// Ative "log LogTemp Verbose" para ver a divisão da pilha entre os players
+static FAutoConsoleCommandWithWorldAndArgs GItemPickupNearestCommand(
+	TEXT("Andromeda.Items.PickupNearest"),
+	TEXT("Andromeda.Items.PickupNearest [Quantity=0] [AllPlayers=0] - Pede o pickup do item mais próximo do player local (0 = pilha inteira)"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+		ACharacter* Character = PlayerController ? Cast<ACharacter>(PlayerController->GetPawn()) : nullptr;
+		UItemRegistrySubsystem* ItemRegistry = World ? World->GetSubsystem<UItemRegistrySubsystem>() : nullptr;
+		if (!Character || !ItemRegistry)
+		{
+			return;
+		}
+
+		const int32 Quantity = Args.Num() > 0 ? FMath::Max(0, FCString::Atoi(*Args[0])) : 0;
+		const bool bAllPlayers = Args.Num() > 1 && FCString::Atoi(*Args[1]) != 0 && World->GetNetMode() != NM_Client;
+
+		TArray<AMasterItem*> Items;
+		ItemRegistry->FindItemsInRange(Character->GetActorLocation(), 500.0f, FItemRegistryFilter(), Items);
+		const FVector Origin = Character->GetActorLocation();
+		Items.Sort([&Origin](const AMasterItem& A, const AMasterItem& B)
+		{
+			return FVector::DistSquared(A.GetActorLocation(), Origin) < FVector::DistSquared(B.GetActorLocation(), Origin);
+		});
+		if (Items.Num() == 0)
+		{
+			return;
+		}
+
+		if (!bAllPlayers)
+		{
+			Items[0]->RequestPickup(Character, Quantity);
+			return;
+		}
+
+		for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+		{
+			if (ACharacter* OtherCharacter = It->IsValid() ? Cast<ACharacter>((*It)->GetPawn()) : nullptr)
+			{
+				Items[0]->RequestPickup(OtherCharacter, Quantity);
+			}
+		}
+	}));
+
+UItemPickupComponent::UItemPickupComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	// Tick só com pedidos ou respostas pendentes; depois da lógica do frame para juntar todos os pedidos
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+	SetIsReplicatedByDefault(true);
+}
+
+UItemPickupComponent* UItemPickupComponent::FindForCharacter(const ACharacter* Character)
+{
+	const AController* Controller = Character ? Character->GetController() : nullptr;
+	return Controller ? Controller->FindComponentByClass<UItemPickupComponent>() : nullptr;
+}
+
+ACharacter* UItemPickupComponent::GetPickerCharacter() const
+{
+	const AController* Controller = Cast<AController>(GetOwner());
+	return Controller ? Cast<ACharacter>(Controller->GetPawn()) : nullptr;
+}
+
+bool UItemPickupComponent::QueuePickup(AMasterItem* Item, int32 Quantity)
+{
+	if (!Item || PendingRequests.ContainsByPredicate([Item](const FItemPickupRequest& Request) { return Request.Item == Item; }))
+	{
+		return false;
+	}
+
+	FItemPickupRequest& Request = PendingRequests.AddDefaulted_GetRef();
+	Request.Item = Item;
+	Request.Quantity = Quantity;
+	Request.RequestId = NextRequestId++;
+
+	// A resposta só chega ao controller local (pedidos feitos pelo servidor em nome de players remotos ficam de fora)
+	const APlayerController* PlayerController = Cast<APlayerController>(GetOwner());
+	if (PlayerController && PlayerController->IsLocalController())
+	{
+		RequestTimes.Add(Request.RequestId, FPlatformTime::Seconds());
+	}
+
+	INC_DWORD_STAT(STAT_ItemPickupRequests);
+	SetComponentTickEnabled(true);
+	return true;
+}
+
+void UItemPickupComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	FlushPendingRequests();
+
+	// Entregar o que já venceu o atraso simulado (servidor: pedidos, cliente: respostas)
+	const double Now = FPlatformTime::Seconds();
+	while (DelayedRequests.Num() > 0 && DelayedRequests[0].Key <= Now)
+	{
+		const TArray<FItemPickupRequest> Requests = MoveTemp(DelayedRequests[0].Value);
+		DelayedRequests.RemoveAt(0, 1, false);
+		ProcessRequests(Requests);
+	}
+	while (DelayedResults.Num() > 0 && DelayedResults[0].Key <= Now)
+	{
+		const TArray<FItemPickupResult> Results = MoveTemp(DelayedResults[0].Value);
+		DelayedResults.RemoveAt(0, 1, false);
+		ApplyResults(Results);
+	}
+
+	if (PendingRequests.Num() == 0 && DelayedRequests.Num() == 0 && DelayedResults.Num() == 0)
+	{
+		SetComponentTickEnabled(false);
+	}
+}
+
+void UItemPickupComponent::FlushPendingRequests()
+{
+	if (PendingRequests.Num() == 0)
+	{
+		return;
+	}
+
+	// Pedidos do frame em um único RPC (ou em blocos do limite aceito pelo servidor)
+	if (PendingRequests.Num() <= MaxPickupRequestsPerBatch)
+	{
+		INC_DWORD_STAT(STAT_ItemPickupRPCs);
+		ServerPickupItems(PendingRequests);
+	}
+	else
+	{
+		for (int32 Start = 0; Start < PendingRequests.Num(); Start += MaxPickupRequestsPerBatch)
+		{
+			const int32 Count = FMath::Min(MaxPickupRequestsPerBatch, PendingRequests.Num() - Start);
+			INC_DWORD_STAT(STAT_ItemPickupRPCs);
+			ServerPickupItems(TArray<FItemPickupRequest>(PendingRequests.GetData() + Start, Count));
+		}
+	}
+	PendingRequests.Reset();
+}
+
+void UItemPickupComponent::ServerPickupItems_Implementation(const TArray<FItemPickupRequest>& Requests)
+{
+	const float SimulatedLatency = CVarItemPickupSimulatedLatency.GetValueOnGameThread();
+	if (SimulatedLatency > 0.0f)
+	{
+		DelayedRequests.Emplace(FPlatformTime::Seconds() + SimulatedLatency, Requests);
+		SetComponentTickEnabled(true);
+		return;
+	}
+
+	ProcessRequests(Requests);
+}
+
+void UItemPickupComponent::ProcessRequests(const TArray<FItemPickupRequest>& Requests)
+{
+	ACharacter* Picker = GetPickerCharacter();
+
+	// Pedidos são resolvidos em série no game thread: quem chega primeiro leva, o próximo vê a pilha já dividida
+	// Acima do limite o pedido não é resolvido, mas é respondido com 0 para o cliente desfazer a predição
+	TArray<FItemPickupResult> Results;
+	Results.Reserve(Requests.Num());
+	for (int32 Index = 0; Index < Requests.Num(); ++Index)
+	{
+		const FItemPickupRequest& Request = Requests[Index];
+		FItemPickupResult& Result = Results.AddDefaulted_GetRef();
+		Result.Item = Request.Item;
+		Result.RequestId = Request.RequestId;
+
+		AMasterItem* Item = Request.Item;
+		if (!Picker || !IsValid(Item) || Index >= MaxPickupRequestsPerBatch)
+		{
+			continue;
+		}
+
+		const FName ItemID = Item->GetItemID();
+		UItemDefinition* Definition = Item->GetDefinition();
+		Result.Granted = Item->ServerTryPickup(Picker, Request.Quantity, Result.bRemoved);
+
+		UE_LOG(LogTemp, Verbose, TEXT("UItemPickupComponent: %s pediu %s x%d, concedido %d%s"),
+			*Picker->GetName(), *ItemID.ToString(), Request.Quantity, Result.Granted, Result.bRemoved ? TEXT(" (pilha esvaziada)") : TEXT(""));
+
+		if (Result.Granted > 0)
+		{
+			OnItemPickedUp.Broadcast(Picker, ItemID, Definition, Result.Granted);
+		}
+	}
+
+	ClientPickupResults(Results);
+}
+
+void UItemPickupComponent::ClientPickupResults_Implementation(const TArray<FItemPickupResult>& Results)
+{
+	const float SimulatedLatency = CVarItemPickupSimulatedLatency.GetValueOnGameThread();
+	if (SimulatedLatency > 0.0f)
+	{
+		DelayedResults.Emplace(FPlatformTime::Seconds() + SimulatedLatency, Results);
+		SetComponentTickEnabled(true);
+		return;
+	}
+
+	ApplyResults(Results);
+}
+
+void UItemPickupComponent::ApplyResults(const TArray<FItemPickupResult>& Results)
+{
+	for (const FItemPickupResult& Result : Results)
+	{
+		double RequestTime = 0.0;
+		if (RequestTimes.RemoveAndCopyValue(Result.RequestId, RequestTime))
+		{
+			SET_FLOAT_STAT(STAT_ItemPickupConfirmLatency, (FPlatformTime::Seconds() - RequestTime) * 1000.0);
+		}
+
+		// Pilha esvaziada: o ator sai pela replicação e continua escondido até lá
+		// Rejeitado ou parcial: o que sobrou continua no mundo, desfazer a predição
+		AMasterItem* Item = Result.Item;
+		if (!Result.bRemoved && IsValid(Item))
+		{
+			Item->SetPickupPredicted(false);
+			if (Result.Granted == 0)
+			{
+				INC_DWORD_STAT(STAT_ItemPickupRollbacks);
+			}
+		}
+	}
+}
@@ -0,0 +1,98 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Component: ItemPickup
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "ItemPickupComponent.generated.h"
+
+class AMasterItem;
+class ACharacter;
+class APlayerController;
+class UItemDefinition;
+
+USTRUCT()
+struct FItemPickupRequest
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<AMasterItem> Item;
+
+	// 0 = pilha inteira
+	UPROPERTY()
+	int32 Quantity = 0;
+
+	UPROPERTY()
+	uint16 RequestId = 0;
+};
+
+USTRUCT()
+struct FItemPickupResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<AMasterItem> Item;
+
+	// Quantidade concedida; 0 = rejeitado
+	UPROPERTY()
+	int32 Granted = 0;
+
+	// Verdadeiro quando o pedido esvaziou a pilha e o ator saiu do mundo
+	UPROPERTY()
+	bool bRemoved = false;
+
+	UPROPERTY()
+	uint16 RequestId = 0;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnItemPickedUp, ACharacter*, Picker, FName, ItemID, UItemDefinition*, Definition, int32, Quantity);
+
+/**
+ * Pipeline de pickup do player (adicionar ao PlayerController do jogo)
+ * Cliente: AMasterItem::RequestPickup esconde o item na hora e o pedido entra na fila do frame
+ * Os pedidos do frame saem em um único RPC; o servidor resolve em ordem e responde também em lote
+ * Pedido rejeitado ou parcial devolve o item ao mundo no cliente (rollback da predição)
+ */
+UCLASS(ClassGroup = (Andromeda), meta = (BlueprintSpawnableComponent))
+class ANDROMEDA_API UItemPickupComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UItemPickupComponent(const FObjectInitializer& ObjectInitializer);
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	// Componente do controller do personagem (nulo para personagens remotos no cliente)
+	static UItemPickupComponent* FindForCharacter(const ACharacter* Character);
+
+	// Enfileira o pedido para o RPC do frame; retorna falso se o mesmo item já estiver na fila
+	bool QueuePickup(AMasterItem* Item, int32 Quantity);
+
+	// Servidor: disparado para cada pickup concedido (inventário do jogo)
+	UPROPERTY(BlueprintAssignable, Category = "Item|Pickup")
+	FOnItemPickedUp OnItemPickedUp;
+
+protected:
+	UFUNCTION(Server, Reliable)
+	void ServerPickupItems(const TArray<FItemPickupRequest>& Requests);
+
+	UFUNCTION(Client, Reliable)
+	void ClientPickupResults(const TArray<FItemPickupResult>& Results);
+
+private:
+	void FlushPendingRequests();
+	void ProcessRequests(const TArray<FItemPickupRequest>& Requests);
+	void ApplyResults(const TArray<FItemPickupResult>& Results);
+	ACharacter* GetPickerCharacter() const;
+
+	TArray<FItemPickupRequest> PendingRequests;
+	TMap<uint16, double> RequestTimes; // Cliente: para a latência de confirmação
+	uint16 NextRequestId = 0;
+
+	// Atraso artificial (andromeda.Items.PickupSimulatedLatency) para testar predição em listen server local
+	TArray<TPair<double, TArray<FItemPickupRequest>>> DelayedRequests;
+	TArray<TPair<double, TArray<FItemPickupResult>>> DelayedResults;
+};
@@ -0,0 +1,150 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Actor: ItemWorldList
+
+#include "ItemWorldListActor.h"
+#include "AndromedaSystemsC/DynamicItems/Core/MasterItem.h"
+#include "AndromedaSystemsC/DynamicItems/Data/ItemReplicationSettings.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemWorldListSubsystem.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+#include "Net/UnrealNetwork.h"
+
+void FItemWorldListEntry::SetTransform(const FTransform& Transform)
+{
+	const FRotator Rotation = Transform.Rotator();
+	Location = Transform.GetLocation();
+	Pitch = FRotator::CompressAxisToShort(Rotation.Pitch);
+	Yaw = FRotator::CompressAxisToShort(Rotation.Yaw);
+	Roll = FRotator::CompressAxisToShort(Rotation.Roll);
+}
+
+FTransform FItemWorldListEntry::GetTransform(const FVector& Scale) const
+{
+	const FRotator Rotation(FRotator::DecompressAxisFromShort(Pitch), FRotator::DecompressAxisFromShort(Yaw), FRotator::DecompressAxisFromShort(Roll));
+	return FTransform(Rotation, Location, Scale);
+}
+
+void FItemWorldListEntry::PostReplicatedAdd(const FItemWorldList& InArraySerializer)
+{
+	UWorld* World = InArraySerializer.Owner ? InArraySerializer.Owner->GetWorld() : nullptr;
+	if (UItemWorldListSubsystem* WorldList = World ? World->GetSubsystem<UItemWorldListSubsystem>() : nullptr)
+	{
+		WorldList->OnEntryAdded(InArraySerializer.Owner, *this);
+	}
+}
+
+void FItemWorldListEntry::PostReplicatedChange(const FItemWorldList& InArraySerializer)
+{
+	UWorld* World = InArraySerializer.Owner ? InArraySerializer.Owner->GetWorld() : nullptr;
+	if (UItemWorldListSubsystem* WorldList = World ? World->GetSubsystem<UItemWorldListSubsystem>() : nullptr)
+	{
+		WorldList->OnEntryChanged(InArraySerializer.Owner, *this);
+	}
+}
+
+void FItemWorldListEntry::PreReplicatedRemove(const FItemWorldList& InArraySerializer)
+{
+	UWorld* World = InArraySerializer.Owner ? InArraySerializer.Owner->GetWorld() : nullptr;
+	if (UItemWorldListSubsystem* WorldList = World ? World->GetSubsystem<UItemWorldListSubsystem>() : nullptr)
+	{
+		WorldList->OnEntryRemoved(InArraySerializer.Owner, *this);
+	}
+}
+
+AItemWorldListActor::AItemWorldListActor(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	PrimaryActorTick.bCanEverTick = false;
+	bReplicates = true;
+	SetReplicateMovement(false);
+
+	// Registros mudam pouco: entradas alteradas saem no próximo update da célula
+	NetUpdateFrequency = 10.0f;
+	MinNetUpdateFrequency = 2.0f;
+
+	// Posicionado no centro da célula: o cull cobre a célula inteira mais o cull dos itens
+	const UItemReplicationSettings* Settings = GetDefault<UItemReplicationSettings>();
+	NetCullDistanceSquared = FMath::Square(Settings->ItemCullDistance + Settings->ItemGridCellSize * UE_HALF_SQRT_2);
+
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+
+	WorldList.Owner = this;
+}
+
+void AItemWorldListActor::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(AItemWorldListActor, WorldList);
+}
+
+void AItemWorldListActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Cliente: a célula saiu de relevância ou foi destruída sem callbacks de remoção por entrada
+	if (!HasAuthority())
+	{
+		if (UItemWorldListSubsystem* WorldListSubsystem = GetWorld()->GetSubsystem<UItemWorldListSubsystem>())
+		{
+			WorldListSubsystem->OnListActorRemoved(this);
+		}
+	}
+
+	for (const TWeakObjectPtr<AMasterItem>& Owner : Owners)
+	{
+		if (AMasterItem* Item = Owner.Get())
+		{
+			Item->WorldListActor = nullptr;
+			Item->WorldListIndex = INDEX_NONE;
+		}
+	}
+	Owners.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AItemWorldListActor::AddItem(AMasterItem* Item)
+{
+	FItemWorldListEntry& Entry = WorldList.Entries.AddDefaulted_GetRef();
+	Entry.ID = Item->GetItemID();
+	Entry.Quantity = Item->GetQuantity();
+	Entry.SetTransform(Item->GetActorTransform());
+	WorldList.MarkItemDirty(Entry);
+
+	Item->WorldListActor = this;
+	Item->WorldListIndex = Owners.Add(Item);
+}
+
+void AItemWorldListActor::UpdateItem(AMasterItem* Item)
+{
+	if (!WorldList.Entries.IsValidIndex(Item->WorldListIndex))
+	{
+		return;
+	}
+
+	FItemWorldListEntry& Entry = WorldList.Entries[Item->WorldListIndex];
+	Entry.Quantity = Item->GetQuantity();
+	Entry.SetTransform(Item->GetActorTransform());
+	WorldList.MarkItemDirty(Entry);
+}
+
+void AItemWorldListActor::RemoveItem(AMasterItem* Item)
+{
+	const int32 Index = Item->WorldListIndex;
+	Item->WorldListActor = nullptr;
+	Item->WorldListIndex = INDEX_NONE;
+	if (!Owners.IsValidIndex(Index))
+	{
+		return;
+	}
+
+	// Remoção com swap: a última entrada ocupa o lugar da removida e o dono recebe o novo índice
+	WorldList.Entries.RemoveAtSwap(Index, 1, false);
+	Owners.RemoveAtSwap(Index, 1, false);
+	if (Owners.IsValidIndex(Index))
+	{
+		if (AMasterItem* MovedItem = Owners[Index].Get())
+		{
+			MovedItem->WorldListIndex = Index;
+		}
+	}
+	WorldList.MarkArrayDirty();
+}
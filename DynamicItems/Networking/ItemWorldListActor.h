@@ -0,0 +1,109 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Actor: ItemWorldList
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "ItemWorldListActor.generated.h"
+
+class AMasterItem;
+class AItemWorldListActor;
+struct FItemWorldList;
+
+/**
+ * Registro compacto de um item assentado no chão
+ * Escala, estado e raridade vêm da definição do ID; só o que varia por item é replicado
+ */
+USTRUCT()
+struct FItemWorldListEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FName ID;
+
+	UPROPERTY()
+	int32 Quantity = 1;
+
+	// Posição quantizada em 0.1 unidade e rotação em 16 bits por eixo
+	UPROPERTY()
+	FVector_NetQuantize10 Location;
+
+	UPROPERTY()
+	uint16 Pitch = 0;
+
+	UPROPERTY()
+	uint16 Yaw = 0;
+
+	UPROPERTY()
+	uint16 Roll = 0;
+
+	void SetTransform(const FTransform& Transform);
+	FTransform GetTransform(const FVector& Scale) const;
+
+	// Cliente: monta, atualiza e remove a apresentação local (UItemWorldListSubsystem)
+	void PostReplicatedAdd(const FItemWorldList& InArraySerializer);
+	void PostReplicatedChange(const FItemWorldList& InArraySerializer);
+	void PreReplicatedRemove(const FItemWorldList& InArraySerializer);
+};
+
+USTRUCT()
+struct FItemWorldList : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FItemWorldListEntry> Entries;
+
+	// Ator dono da lista (callbacks do cliente)
+	UPROPERTY(NotReplicated)
+	TObjectPtr<AItemWorldListActor> Owner;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FItemWorldListEntry, FItemWorldList>(Entries, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FItemWorldList> : public TStructOpsTypeTraitsBase2<FItemWorldList>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
+/**
+ * Replica os itens assentados de uma célula da grade como uma única lista (FFastArraySerializer)
+ * O ator do item sai da replicação enquanto está na lista: um canal por célula no lugar de um por item
+ * Só as entradas alteradas são enviadas; o cliente monta instâncias locais a partir dos registros
+ */
+UCLASS(NotPlaceable, Transient)
+class ANDROMEDA_API AItemWorldListActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AItemWorldListActor(const FObjectInitializer& ObjectInitializer);
+
+	// Servidor: adiciona, atualiza e remove o registro do item (índice guardado em Item->WorldListIndex)
+	void AddItem(AMasterItem* Item);
+	void UpdateItem(AMasterItem* Item);
+	void RemoveItem(AMasterItem* Item);
+
+	FORCEINLINE int32 GetNumEntries() const { return WorldList.Entries.Num(); }
+	FORCEINLINE const TArray<FItemWorldListEntry>& GetEntries() const { return WorldList.Entries; }
+
+protected:
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+private:
+	UPROPERTY(Replicated)
+	FItemWorldList WorldList;
+
+	// Servidor: dono de cada entrada, no mesmo índice de WorldList.Entries
+	TArray<TWeakObjectPtr<AMasterItem>> Owners;
+};
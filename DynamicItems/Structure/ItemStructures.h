@@ -1,4 +1,4 @@
-// Dynamic item system // Version 1.0.0 // date: 2026-01-29 // last update: 2026-01-29 // Author: Pilha-DS // Structure2: MasterItem	
+// Dynamic item system // Version 1.0.0 // date: 2026-01-29 // last update: 2026-10-16 // Author: Pilha-DS // Structure2: MasterItem	
 
 
 #pragma once
@@ -23,6 +23,10 @@ struct FSTModel
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item|Model")
 	FVector Size = FVector(1.0f, 1.0f, 1.0f);
+
+	// Prioridade do carregamento assíncrono do mesh (maior carrega antes)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item|Model")
+	int32 MeshLoadPriority = 0;
 };
 
 USTRUCT(BlueprintType)
@@ -116,6 +120,10 @@ struct FCollisionSphereSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WorldView|CollisionSphere")
 	float MinimumSize = 200.0f;
+
+	// Tempo em segundos até o mesmo player poder ativar o item de novo depois de sair do alcance
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "WorldView|CollisionSphere", meta = (ClampMin = "0.0"))
+	float OverlapCooldownTime = 5.0f;
 };
 
 USTRUCT(BlueprintType)
@@ -0,0 +1,251 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemBatchSpawn
+
+#include "ItemBatchSpawnSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/MasterItem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/ItemStats.h"
+#include "AndromedaSystemsC/DynamicItems/Data/ItemDefinition.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemDefinitionRegistry.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemManagerSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemPoolSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Batch Spawn"), STAT_ItemBatchSpawn, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pending Batch Spawns"), STAT_ItemBatchPendingSpawns, STATGROUP_AndromedaItems);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Batch Spawn Frame (ms)"), STAT_ItemBatchSpawnFrameMs, STATGROUP_AndromedaItems);
+
+static TAutoConsoleVariable<float> CVarItemSpawnBudgetMs(
+	TEXT("andromeda.Items.SpawnBudgetMs"),
+	2.0f,
+	TEXT("Tempo máximo por frame (ms) gasto criando itens de lotes (SpawnItemsBatch). Pelo menos um item é criado por frame."),
+	ECVF_Default);
+
+// Pior frame de um drop em massa: com Batched=1 o drop passa por SpawnItemsBatch, com 0 tudo sai no mesmo frame
+// Mesmo drop do Andromeda.Items.MassDrop, mais espalhado e sem empilhar
+static FAutoConsoleCommandWithWorldAndArgs GItemSpawnBatchBenchmarkCommand(
+	TEXT("Andromeda.Items.SpawnBatchBenchmark"),
+	TEXT("Andromeda.Items.SpawnBatchBenchmark <Count> <ItemID> [Batched=1] - Drop de Count itens (ex: 500) e mede o pior frame de spawn"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UItemBatchSpawnSubsystem* BatchSpawn = World ? World->GetSubsystem<UItemBatchSpawnSubsystem>() : nullptr;
+		UItemDefinitionRegistry* Registry = UItemDefinitionRegistry::Get(World);
+		if (!BatchSpawn || !Registry || Args.Num() < 2)
+		{
+			return;
+		}
+
+		const int32 Count = FMath::Max(1, FCString::Atoi(*Args[0]));
+		UItemDefinition* Definition = Registry->FindDefinition(FName(*Args[1]));
+		const bool bBatched = Args.Num() < 3 || FCString::Atoi(*Args[2]) != 0;
+		if (Definition)
+		{
+			BatchSpawn->SpawnMassDrop(Definition, Count, 400.0f, 0.0f, bBatched);
+		}
+	}));
+
+bool UItemBatchSpawnSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Spawn de itens é do servidor, como o UItemPoolSubsystem
+	const UWorld* World = Cast<UWorld>(Outer);
+	return Super::ShouldCreateSubsystem(Outer) && (!World || World->GetNetMode() != NM_Client);
+}
+
+void UItemBatchSpawnSubsystem::Deinitialize()
+{
+	Batches.Reset();
+	NumPendingSpawns = 0;
+
+	Super::Deinitialize();
+}
+
+TStatId UItemBatchSpawnSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UItemBatchSpawnSubsystem, STATGROUP_Tickables);
+}
+
+int32 UItemBatchSpawnSubsystem::SpawnItemsBatch(const TArray<FItemSpawnRequest>& Requests, FOnItemSpawnBatchProgress OnProgress)
+{
+	FItemSpawnBatch NewBatch;
+	NewBatch.Requests.Reserve(Requests.Num());
+	for (const FItemSpawnRequest& Request : Requests)
+	{
+		if (Request.Definition)
+		{
+			NewBatch.Requests.Add(Request);
+		}
+	}
+
+	if (NewBatch.Requests.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	SortByPlayerDistance(NewBatch.Requests);
+	NewBatch.Handle = NextBatchHandle++;
+	NewBatch.NumTotal = NewBatch.Requests.Num();
+	NewBatch.OnProgress = MoveTemp(OnProgress);
+
+	NumPendingSpawns += NewBatch.NumTotal;
+	SET_DWORD_STAT(STAT_ItemBatchPendingSpawns, NumPendingSpawns);
+
+	const int32 Handle = NewBatch.Handle;
+	Batches.Add(MoveTemp(NewBatch));
+	return Handle;
+}
+
+float UItemBatchSpawnSubsystem::GetBatchProgress(int32 BatchHandle) const
+{
+	for (const FItemSpawnBatch& Batch : Batches)
+	{
+		if (Batch.Handle == BatchHandle)
+		{
+			return 1.0f - static_cast<float>(Batch.Requests.Num()) / Batch.NumTotal;
+		}
+	}
+	return 1.0f;
+}
+
+void UItemBatchSpawnSubsystem::SpawnMassDrop(UItemDefinition* Definition, int32 Count, float Spread, float HeightStep, bool bBatched)
+{
+	UItemPoolSubsystem* Pool = GetWorld()->GetSubsystem<UItemPoolSubsystem>();
+	if (!Definition || !Pool || Count <= 0)
+	{
+		return;
+	}
+
+	const FVector Origin = UItemManagerSubsystem::GetFirstPlayerLocation(GetWorld(), 300.0f);
+	TArray<FItemSpawnRequest> Requests;
+	Requests.Reserve(Count);
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		FItemSpawnRequest& Request = Requests.AddDefaulted_GetRef();
+		Request.Definition = Definition;
+		Request.Transform = FTransform(Origin + FVector(FMath::FRandRange(-Spread, Spread), FMath::FRandRange(-Spread, Spread), 100.0f + Index * HeightStep));
+	}
+
+	if (!bBatched)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		for (const FItemSpawnRequest& Request : Requests)
+		{
+			Pool->AcquireItem(Request.Definition, Request.Quantity, Request.Transform);
+		}
+		UE_LOG(LogTemp, Log, TEXT("UItemBatchSpawnSubsystem: %d itens em um frame, %.3f ms"), Count, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+		return;
+	}
+
+	ResetFrameStats();
+	SpawnItemsBatch(Requests, FOnItemSpawnBatchProgress::CreateWeakLambda(this, [this](int32 NumSpawned, int32 NumTotal)
+	{
+		if (NumSpawned == NumTotal)
+		{
+			UE_LOG(LogTemp, Log, TEXT("UItemBatchSpawnSubsystem: %d itens em %d frames, pior frame de spawn %.3f ms"),
+				NumTotal, NumSpawnFrames, WorstSpawnFrameMs);
+		}
+	}));
+}
+
+void UItemBatchSpawnSubsystem::ResetFrameStats()
+{
+	WorstSpawnFrameMs = 0.0;
+	NumSpawnFrames = 0;
+}
+
+void UItemBatchSpawnSubsystem::SortByPlayerDistance(TArray<FItemSpawnRequest>& Requests) const
+{
+	TArray<FVector> PlayerLocations;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (const APawn* Pawn = It->IsValid() ? (*It)->GetPawn() : nullptr)
+		{
+			PlayerLocations.Add(Pawn->GetActorLocation());
+		}
+	}
+
+	if (PlayerLocations.Num() == 0)
+	{
+		return;
+	}
+
+	// Distância ao player mais próximo; o mais próximo fica no fim do array
+	TArray<TPair<float, int32>> Distances;
+	Distances.Reserve(Requests.Num());
+	for (int32 Index = 0; Index < Requests.Num(); ++Index)
+	{
+		float MinDistanceSquared = TNumericLimits<float>::Max();
+		for (const FVector& PlayerLocation : PlayerLocations)
+		{
+			MinDistanceSquared = FMath::Min(MinDistanceSquared, static_cast<float>(FVector::DistSquared(PlayerLocation, Requests[Index].Transform.GetLocation())));
+		}
+		Distances.Emplace(MinDistanceSquared, Index);
+	}
+	Distances.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key > B.Key; });
+
+	TArray<FItemSpawnRequest> Sorted;
+	Sorted.Reserve(Requests.Num());
+	for (const TPair<float, int32>& Distance : Distances)
+	{
+		Sorted.Add(MoveTemp(Requests[Distance.Value]));
+	}
+	Requests = MoveTemp(Sorted);
+}
+
+void UItemBatchSpawnSubsystem::Tick(float DeltaTime)
+{
+	if (Batches.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_ItemBatchSpawn);
+
+	UItemPoolSubsystem* Pool = GetWorld()->GetSubsystem<UItemPoolSubsystem>();
+	if (!Pool)
+	{
+		return;
+	}
+
+	// Lotes em ordem de chegada; pelo menos um item por frame para garantir progresso
+	const double StartTime = FPlatformTime::Seconds();
+	const double BudgetSeconds = FMath::Max(0.0f, CVarItemSpawnBudgetMs.GetValueOnGameThread()) / 1000.0;
+	int32 NumSpawned = 0;
+	TArray<int32, TInlineAllocator<4>> ProgressedBatches;
+	for (int32 BatchIndex = 0; BatchIndex < Batches.Num(); ++BatchIndex)
+	{
+		// Acesso por índice: o BeginPlay de um item pode enfileirar outro lote e realocar Batches
+		while (Batches[BatchIndex].Requests.Num() > 0 && (NumSpawned == 0 || FPlatformTime::Seconds() - StartTime < BudgetSeconds))
+		{
+			const FItemSpawnRequest Request = Batches[BatchIndex].Requests.Pop(false);
+			Pool->AcquireItem(Request.Definition, Request.Quantity, Request.Transform);
+			++NumSpawned;
+		}
+		ProgressedBatches.Add(BatchIndex);
+
+		if (Batches[BatchIndex].Requests.Num() > 0)
+		{
+			break;
+		}
+	}
+
+	const double SpawnFrameMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	WorstSpawnFrameMs = FMath::Max(WorstSpawnFrameMs, SpawnFrameMs);
+	++NumSpawnFrames;
+	NumPendingSpawns -= NumSpawned;
+	SET_DWORD_STAT(STAT_ItemBatchPendingSpawns, NumPendingSpawns);
+	SET_FLOAT_STAT(STAT_ItemBatchSpawnFrameMs, SpawnFrameMs);
+
+	// Progresso reportado depois do trabalho do frame e com a fila já atualizada (o callback pode enfileirar outro lote)
+	TArray<TTuple<FOnItemSpawnBatchProgress, int32, int32>, TInlineAllocator<4>> Progress;
+	for (int32 BatchIndex : ProgressedBatches)
+	{
+		const FItemSpawnBatch& Batch = Batches[BatchIndex];
+		Progress.Emplace(Batch.OnProgress, Batch.NumTotal - Batch.Requests.Num(), Batch.NumTotal);
+	}
+	Batches.RemoveAll([](const FItemSpawnBatch& Batch) { return Batch.Requests.Num() == 0; });
+
+	for (const TTuple<FOnItemSpawnBatchProgress, int32, int32>& BatchProgress : Progress)
+	{
+		BatchProgress.Get<0>().ExecuteIfBound(BatchProgress.Get<1>(), BatchProgress.Get<2>());
+	}
+}
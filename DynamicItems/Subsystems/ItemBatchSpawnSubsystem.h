@@ -0,0 +1,88 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemBatchSpawn
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ItemBatchSpawnSubsystem.generated.h"
+
+class AMasterItem;
+class UItemDefinition;
+
+USTRUCT(BlueprintType)
+struct FItemSpawnRequest
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item")
+	TObjectPtr<UItemDefinition> Definition;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item", meta = (ClampMin = "1"))
+	int32 Quantity = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item")
+	FTransform Transform;
+};
+
+// Progresso de um lote: chamado ao fim de cada frame em que o lote avançou
+DECLARE_DELEGATE_TwoParams(FOnItemSpawnBatchProgress, int32 /*NumSpawned*/, int32 /*NumTotal*/);
+
+/**
+ * Spawn de drops em massa espalhado entre frames (andromeda.Items.SpawnBudgetMs por frame)
+ * Cada item passa pelo UItemPoolSubsystem; os mais próximos de players saem primeiro
+ * Só existe com autoridade, como o pool
+ */
+UCLASS()
+class ANDROMEDA_API UItemBatchSpawnSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Enfileira o lote; retorna o handle usado em GetBatchProgress (INDEX_NONE se vazio)
+	int32 SpawnItemsBatch(const TArray<FItemSpawnRequest>& Requests, FOnItemSpawnBatchProgress OnProgress = FOnItemSpawnBatchProgress());
+
+	UFUNCTION(BlueprintCallable, Category = "Item|Spawn", meta = (DisplayName = "Spawn Items Batch"))
+	int32 K2_SpawnItemsBatch(const TArray<FItemSpawnRequest>& Requests) { return SpawnItemsBatch(Requests); }
+
+	// 0 a 1; lotes concluídos ou desconhecidos retornam 1
+	UFUNCTION(BlueprintCallable, Category = "Item|Spawn")
+	float GetBatchProgress(int32 BatchHandle) const;
+
+	FORCEINLINE int32 GetNumPendingSpawns() const { return NumPendingSpawns; }
+
+	// Drop em massa amontoado na frente do primeiro player (Andromeda.Items.MassDrop e SpawnBatchBenchmark)
+	// HeightStep empilha cada item acima do anterior (0 = todos a 100 do chão)
+	// bBatched passa por SpawnItemsBatch; senão tudo sai do pool no mesmo frame. O custo vai para o log
+	void SpawnMassDrop(UItemDefinition* Definition, int32 Count, float Spread, float HeightStep, bool bBatched);
+
+	// Medição: maior custo de spawn em um frame e frames usados desde o último ResetFrameStats
+	void ResetFrameStats();
+	FORCEINLINE double GetWorstSpawnFrameMs() const { return WorstSpawnFrameMs; }
+	FORCEINLINE int32 GetNumSpawnFrames() const { return NumSpawnFrames; }
+
+private:
+	struct FItemSpawnBatch
+	{
+		int32 Handle = INDEX_NONE;
+		TArray<FItemSpawnRequest> Requests; // Ordenado do mais distante para o mais próximo (Pop tira o mais próximo)
+		int32 NumTotal = 0;
+		FOnItemSpawnBatchProgress OnProgress;
+	};
+
+	void SortByPlayerDistance(TArray<FItemSpawnRequest>& Requests) const;
+
+	TArray<FItemSpawnBatch> Batches;
+	int32 NextBatchHandle = 0;
+	int32 NumPendingSpawns = 0;
+
+	double WorstSpawnFrameMs = 0.0;
+	int32 NumSpawnFrames = 0;
+};
@@ -0,0 +1,191 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemCooldown
+
+#include "ItemCooldownSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/MasterItem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/ItemStats.h"
+#include "AndromedaSystemsC/DynamicItems/Diagnostics/ItemTrace.h"
+#include "GameFramework/Character.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Cooldown Wheel"), STAT_ItemCooldownWheel, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Cooldowns"), STAT_ItemCooldownActive, STATGROUP_AndromedaItems);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Expired Cooldowns"), STAT_ItemCooldownExpired, STATGROUP_AndromedaItems);
+
+// Compara a varredura de TMap por item a cada frame com o timing wheel compartilhado
+// Não usa atores: mede só a estrutura de dados com Items x Players cooldowns simultâneos
+static FAutoConsoleCommandWithWorldAndArgs GItemCooldownBenchmarkCommand(
+	TEXT("Andromeda.Items.CooldownBenchmark"),
+	TEXT("Andromeda.Items.CooldownBenchmark [Items=10000] [Players=64] [Cooldown=5] - Mede varredura por item vs timing wheel"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		const int32 NumItems = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10000;
+		const int32 NumPlayers = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 64;
+		const float Cooldown = Args.Num() > 2 ? FMath::Max(0.1f, FCString::Atof(*Args[2])) : 5.0f;
+		const float FrameTime = 1.0f / 60.0f;
+		const int32 NumFrames = FMath::CeilToInt((Cooldown + 1.0f) / FrameTime);
+
+		// Saídas espalhadas no primeiro segundo, com a mesma sequência para os dois casos
+		FRandomStream Random(1234);
+		TArray<float> StartTimes;
+		StartTimes.SetNumUninitialized(NumItems * NumPlayers);
+		for (float& StartTime : StartTimes)
+		{
+			StartTime = Random.FRand();
+		}
+
+		// Caso 1: TMap<Player, Início> por item, varrido por completo a cada frame
+		TArray<TMap<int32, float>> ItemMaps;
+		ItemMaps.SetNum(NumItems);
+		for (int32 Item = 0; Item < NumItems; ++Item)
+		{
+			for (int32 Player = 0; Player < NumPlayers; ++Player)
+			{
+				ItemMaps[Item].Add(Player, StartTimes[Item * NumPlayers + Player]);
+			}
+		}
+
+		int32 MapExpired = 0;
+		double StartSeconds = FPlatformTime::Seconds();
+		for (int32 Frame = 1; Frame <= NumFrames; ++Frame)
+		{
+			const float Now = Frame * FrameTime;
+			for (TMap<int32, float>& PlayerCooldowns : ItemMaps)
+			{
+				TArray<int32> ExpiredPlayers;
+				for (const TPair<int32, float>& Pair : PlayerCooldowns)
+				{
+					if (Now - Pair.Value >= Cooldown)
+					{
+						ExpiredPlayers.Add(Pair.Key);
+					}
+				}
+				for (int32 Player : ExpiredPlayers)
+				{
+					PlayerCooldowns.Remove(Player);
+				}
+				MapExpired += ExpiredPlayers.Num();
+			}
+		}
+		const double MapMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+
+		// Caso 2: timing wheel compartilhado + índice (Item, Player) -> handle para consultas
+		TItemTimingWheel<uint64> Wheel;
+		TMap<uint64, int32> HandlesByKey;
+		HandlesByKey.Reserve(NumItems * NumPlayers);
+
+		StartSeconds = FPlatformTime::Seconds();
+		for (int32 Item = 0; Item < NumItems; ++Item)
+		{
+			for (int32 Player = 0; Player < NumPlayers; ++Player)
+			{
+				const uint64 Key = (static_cast<uint64>(Item) << 32) | static_cast<uint32>(Player);
+				HandlesByKey.Add(Key, Wheel.Schedule(StartTimes[Item * NumPlayers + Player] + Cooldown, Key));
+			}
+		}
+		const double WheelInsertMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+
+		int32 WheelExpired = 0;
+		StartSeconds = FPlatformTime::Seconds();
+		for (int32 Frame = 1; Frame <= NumFrames; ++Frame)
+		{
+			Wheel.Advance(Frame * FrameTime, [&HandlesByKey, &WheelExpired](uint64 Key)
+			{
+				HandlesByKey.Remove(Key);
+				++WheelExpired;
+			});
+		}
+		const double WheelMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+
+		UE_LOG(LogTemp, Log, TEXT("UItemCooldownSubsystem: %d itens x %d players, %d frames de %.1f ms"), NumItems, NumPlayers, NumFrames, FrameTime * 1000.0f);
+		UE_LOG(LogTemp, Log, TEXT("UItemCooldownSubsystem: varredura TMap   -> %.3f ms total, %.4f ms/frame (%d vencimentos)"), MapMs, MapMs / NumFrames, MapExpired);
+		UE_LOG(LogTemp, Log, TEXT("UItemCooldownSubsystem: timing wheel    -> %.3f ms total, %.4f ms/frame (%d vencimentos, inserção %.3f ms)"), WheelMs, WheelMs / NumFrames, WheelExpired, WheelInsertMs);
+	}));
+
+void UItemCooldownSubsystem::Deinitialize()
+{
+	Wheel.Reset(0.0);
+	HandlesByKey.Reset();
+	ExpiredItems.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UItemCooldownSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UItemCooldownSubsystem, STATGROUP_Tickables);
+}
+
+void UItemCooldownSubsystem::StartCooldown(AMasterItem* Item, const ACharacter* Character, float Duration)
+{
+	if (!Item || !Character)
+	{
+		return;
+	}
+
+	const FCooldownKey Key(FObjectKey(Item), FObjectKey(Character));
+	if (const int32* ExistingHandle = HandlesByKey.Find(Key))
+	{
+		Wheel.Cancel(*ExistingHandle);
+	}
+
+	FCooldownEntry Entry;
+	Entry.Item = Item;
+	Entry.ItemKey = Key.Key;
+	Entry.Character = FObjectKey(Character);
+	Entry.Generation = Item->CooldownGeneration;
+
+	HandlesByKey.Add(Key, Wheel.Schedule(GetWorld()->GetTimeSeconds() + Duration, MoveTemp(Entry)));
+	ITEM_TRACE(CooldownStart, Item, FMath::Clamp(FMath::RoundToInt(Duration * 1000.0f), 0, static_cast<int32>(MAX_uint16)));
+	SET_DWORD_STAT(STAT_ItemCooldownActive, Wheel.Num());
+}
+
+bool UItemCooldownSubsystem::IsOnCooldown(const AMasterItem* Item, const ACharacter* Character) const
+{
+	if (!Item || !Character)
+	{
+		return false;
+	}
+
+	const int32* Handle = HandlesByKey.Find(FCooldownKey(FObjectKey(Item), FObjectKey(Character)));
+	return Handle && Wheel.Get(*Handle).Generation == Item->CooldownGeneration;
+}
+
+void UItemCooldownSubsystem::ClearItemCooldowns(AMasterItem* Item)
+{
+	if (Item)
+	{
+		++Item->CooldownGeneration;
+	}
+}
+
+void UItemCooldownSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ItemCooldownWheel);
+
+	// Primeiro remover do índice todos os vencidos, depois avisar os itens (que podem iniciar novos cooldowns)
+	Wheel.Advance(GetWorld()->GetTimeSeconds(), [this](FCooldownEntry&& Entry)
+	{
+		HandlesByKey.Remove(FCooldownKey(Entry.ItemKey, Entry.Character));
+		INC_DWORD_STAT(STAT_ItemCooldownExpired);
+
+		const AMasterItem* Item = Entry.Item.Get();
+		if (Item && Entry.Generation == Item->CooldownGeneration)
+		{
+			// Repetições do mesmo item são inofensivas: a reavaliação para no primeiro player aceito
+			ExpiredItems.Add(Entry.Item);
+			ITEM_TRACE(CooldownExpire, Item, 0);
+		}
+	});
+
+	for (const TWeakObjectPtr<AMasterItem>& ExpiredItem : ExpiredItems)
+	{
+		if (AMasterItem* Item = ExpiredItem.Get())
+		{
+			Item->OnOverlapCooldownExpired();
+		}
+	}
+	ExpiredItems.Reset();
+
+	SET_DWORD_STAT(STAT_ItemCooldownActive, Wheel.Num());
+}
@@ -0,0 +1,55 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemCooldown
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "AndromedaSystemsC/DynamicItems/Core/ItemTimingWheel.h"
+#include "ItemCooldownSubsystem.generated.h"
+
+class AMasterItem;
+class ACharacter;
+
+/**
+ * Cooldowns de overlap (item, player) de todos os itens em um único timing wheel
+ * As chaves são FObjectKey: players destruídos não precisam de varredura, a entrada só vence e sai
+ * No vencimento o item é avisado uma vez para reavaliar quem está no alcance
+ */
+UCLASS()
+class ANDROMEDA_API UItemCooldownSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Inicia (ou reinicia) o cooldown do player neste item
+	void StartCooldown(AMasterItem* Item, const ACharacter* Character, float Duration);
+	bool IsOnCooldown(const AMasterItem* Item, const ACharacter* Character) const;
+
+	// Invalida todos os cooldowns do item (saída para o pool); as entradas antigas vencem sem efeito
+	void ClearItemCooldowns(AMasterItem* Item);
+
+	FORCEINLINE int32 GetNumCooldowns() const { return Wheel.Num(); }
+
+private:
+	using FCooldownKey = TPair<FObjectKey, FObjectKey>; // (Item, Character)
+
+	struct FCooldownEntry
+	{
+		TWeakObjectPtr<AMasterItem> Item;
+		FObjectKey ItemKey;
+		FObjectKey Character;
+		uint32 Generation = 0;
+	};
+
+	TItemTimingWheel<FCooldownEntry> Wheel;
+	TMap<FCooldownKey, int32> HandlesByKey;
+	TArray<TWeakObjectPtr<AMasterItem>> ExpiredItems;
+};
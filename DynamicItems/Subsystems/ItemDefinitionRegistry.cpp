@@ -0,0 +1,152 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemDefinitionRegistry
+
+#include "ItemDefinitionRegistry.h"
+#include "AndromedaSystemsC/DynamicItems/Data/ItemDefinition.h"
+#include "Engine/AssetManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+// Estima a memória economizada por ator ao trocar as cópias de configuração pela definição compartilhada
+static FAutoConsoleCommandWithWorldAndArgs GItemDefinitionMemoryCommand(
+	TEXT("Andromeda.Items.DefinitionMemory"),
+	TEXT("Andromeda.Items.DefinitionMemory [Count] - Memória economizada por ator e para Count itens (padrão 10000)"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		const int32 Count = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10000;
+
+		// Structs que antes eram copiados em cada instância
+		const SIZE_T InlineBytes = sizeof(FSTModel) + sizeof(FSTQty) + sizeof(FSTInfos) + sizeof(FBasicInfos)
+			+ sizeof(FFloatingSettings) + sizeof(FRotationSettings) + sizeof(FLightSettings)
+			+ sizeof(FCollisionSphereSettings) + sizeof(FWidgetsSettings) + sizeof(FString) * 2;
+
+		// Strings alocadas no heap (Name, ID e Description), média das definições carregadas
+		SIZE_T HeapBytes = 0;
+		int32 NumDefinitions = 0;
+		if (UItemDefinitionRegistry* Registry = UItemDefinitionRegistry::Get(World))
+		{
+			for (const FName& ID : UItemDefinitionRegistry::GetItemDefinitionIds())
+			{
+				if (const UItemDefinition* Definition = Registry->FindDefinition(ID))
+				{
+					HeapBytes += Definition->Name.GetAllocatedSize() + Definition->STInfos.Description.GetAllocatedSize() + (ID.ToString().Len() + 1) * sizeof(TCHAR);
+					++NumDefinitions;
+				}
+			}
+		}
+		const SIZE_T AverageHeapBytes = NumDefinitions > 0 ? HeapBytes / NumDefinitions : 0;
+
+		// O que a instância guarda agora no lugar das cópias
+		const SIZE_T InstanceBytes = sizeof(FName) + sizeof(TObjectPtr<UItemDefinition>) + sizeof(bool);
+
+		const int64 SavedPerActor = static_cast<int64>(InlineBytes + AverageHeapBytes) - static_cast<int64>(InstanceBytes);
+		UE_LOG(LogTemp, Log, TEXT("ItemDefinition: %lld bytes economizados por ator (%llu inline + %llu heap - %llu), %.2f MB para %d itens (%d definições)"),
+			SavedPerActor, static_cast<uint64>(InlineBytes), static_cast<uint64>(AverageHeapBytes), static_cast<uint64>(InstanceBytes),
+			(SavedPerActor * Count) / (1024.0 * 1024.0), Count, NumDefinitions);
+	}));
+
+void UItemDefinitionRegistry::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// Pré-carregar todas as definições de forma assíncrona para que FindDefinition não bloqueie em jogo
+	if (UAssetManager* AssetManager = UAssetManager::GetIfInitialized())
+	{
+		PreloadHandle = AssetManager->LoadPrimaryAssetsWithType(
+			UItemDefinition::PrimaryAssetType,
+			TArray<FName>(),
+			FStreamableDelegate::CreateUObject(this, &UItemDefinitionRegistry::OnDefinitionsPreloaded));
+	}
+}
+
+void UItemDefinitionRegistry::Deinitialize()
+{
+	if (PreloadHandle.IsValid())
+	{
+		PreloadHandle->CancelHandle();
+		PreloadHandle.Reset();
+	}
+	Definitions.Reset();
+
+	Super::Deinitialize();
+}
+
+UItemDefinitionRegistry* UItemDefinitionRegistry::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UItemDefinitionRegistry>() : nullptr;
+}
+
+UItemDefinition* UItemDefinitionRegistry::FindDefinition(FName ID)
+{
+	if (ID.IsNone())
+	{
+		return nullptr;
+	}
+
+	if (TObjectPtr<UItemDefinition>* Found = Definitions.Find(ID))
+	{
+		return *Found;
+	}
+
+	// Ainda não carregada: carregar uma única vez e manter no cache
+	UAssetManager* AssetManager = UAssetManager::GetIfInitialized();
+	if (!AssetManager)
+	{
+		return nullptr;
+	}
+
+	const FSoftObjectPath DefinitionPath = AssetManager->GetPrimaryAssetPath(FPrimaryAssetId(UItemDefinition::PrimaryAssetType, ID));
+	UItemDefinition* Definition = Cast<UItemDefinition>(DefinitionPath.TryLoad());
+	if (Definition)
+	{
+		Definitions.Add(ID, Definition);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UItemDefinitionRegistry: Definição não encontrada para o ID %s"), *ID.ToString());
+	}
+
+	return Definition;
+}
+
+void UItemDefinitionRegistry::RegisterDefinition(UItemDefinition* Definition)
+{
+	if (Definition && !Definition->ID.IsNone())
+	{
+		Definitions.Add(Definition->ID, Definition);
+	}
+}
+
+TArray<FName> UItemDefinitionRegistry::GetItemDefinitionIds()
+{
+	TArray<FName> IDs;
+	if (UAssetManager* AssetManager = UAssetManager::GetIfInitialized())
+	{
+		TArray<FPrimaryAssetId> AssetIds;
+		AssetManager->GetPrimaryAssetIdList(UItemDefinition::PrimaryAssetType, AssetIds);
+		for (const FPrimaryAssetId& AssetId : AssetIds)
+		{
+			IDs.Add(AssetId.PrimaryAssetName);
+		}
+	}
+	IDs.Sort(FNameLexicalLess());
+	return IDs;
+}
+
+void UItemDefinitionRegistry::OnDefinitionsPreloaded()
+{
+	UAssetManager* AssetManager = UAssetManager::GetIfInitialized();
+	if (!AssetManager)
+	{
+		return;
+	}
+
+	TArray<UObject*> LoadedObjects;
+	AssetManager->GetPrimaryAssetObjectList(UItemDefinition::PrimaryAssetType, LoadedObjects);
+	for (UObject* LoadedObject : LoadedObjects)
+	{
+		RegisterDefinition(Cast<UItemDefinition>(LoadedObject));
+	}
+}
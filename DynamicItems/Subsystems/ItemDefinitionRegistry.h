@@ -0,0 +1,48 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemDefinitionRegistry
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "ItemDefinitionRegistry.generated.h"
+
+class UItemDefinition;
+struct FStreamableHandle;
+
+/**
+ * Registro das definições de item (UItemDefinition) indexadas por ID
+ * Cada definição é carregada uma única vez e compartilhada por todas as instâncias
+ */
+UCLASS()
+class ANDROMEDA_API UItemDefinitionRegistry : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	static UItemDefinitionRegistry* Get(const UObject* WorldContextObject);
+
+	// Retorna a definição do ID, carregando-a na primeira vez se o preload ainda não terminou
+	UFUNCTION(BlueprintCallable, Category = "Item")
+	UItemDefinition* FindDefinition(FName ID);
+
+	// Registra uma definição que não vem do Asset Manager (ex: criada em runtime)
+	void RegisterDefinition(UItemDefinition* Definition);
+
+	FORCEINLINE int32 GetNumDefinitions() const { return Definitions.Num(); }
+
+	// Opções de ID para o editor (meta = GetOptions)
+	UFUNCTION()
+	static TArray<FName> GetItemDefinitionIds();
+
+private:
+	void OnDefinitionsPreloaded();
+
+	UPROPERTY(Transient)
+	TMap<FName, TObjectPtr<UItemDefinition>> Definitions;
+
+	TSharedPtr<FStreamableHandle> PreloadHandle;
+};
@@ -0,0 +1,206 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemInstancedRender
+
+#include "ItemInstancedRenderSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/MasterItem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/ItemStats.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemPhysicsSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemWorldListSubsystem.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Instanced Items"), STAT_ItemInstancedItems, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Instance Batches"), STAT_ItemInstanceBatches, STATGROUP_AndromedaItems);
+
+static TAutoConsoleVariable<bool> CVarItemInstancedRendering(
+	TEXT("andromeda.Items.InstancedRendering"),
+	true,
+	TEXT("Se verdadeiro, itens parados no chão são renderizados como instâncias de um HISM compartilhado por mesh."),
+	ECVF_Default);
+
+bool UItemInstancedRenderSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Servidor dedicado não renderiza: nenhum host nem HISM
+	return Super::ShouldCreateSubsystem(Outer) && !IsRunningDedicatedServer();
+}
+
+void UItemInstancedRenderSubsystem::Deinitialize()
+{
+	Batches.Reset();
+	NumInstancedItems = 0;
+
+	if (InstanceHost)
+	{
+		InstanceHost->Destroy();
+		InstanceHost = nullptr;
+	}
+
+	Super::Deinitialize();
+}
+
+bool UItemInstancedRenderSubsystem::CollapseItem(AMasterItem* Item)
+{
+	if (!CVarItemInstancedRendering.GetValueOnGameThread() || !IsValid(Item) || Item->IsInstanced())
+	{
+		return false;
+	}
+
+	// Só itens estáticos com o mesh final carregado (nunca o placeholder)
+	UStaticMeshComponent* MeshComponent = Item->GetStaticMeshComponent();
+	UStaticMesh* Mesh = MeshComponent && MeshComponent->IsVisible() ? MeshComponent->GetStaticMesh() : nullptr;
+	if (!Mesh || Mesh == Item->PlaceholderMesh)
+	{
+		return false;
+	}
+
+	FItemInstanceOwner Owner;
+	Owner.Item = Item;
+	const int32 InstanceIndex = AddInstance(Mesh, MeshComponent->GetComponentTransform(), Owner);
+	if (InstanceIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	Item->InstancedMesh = Mesh;
+	Item->InstanceIndex = InstanceIndex;
+
+	// Sem corpo físico e sem draw call próprio enquanto estiver instanciado
+	MeshComponent->SetSimulatePhysics(false);
+	MeshComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	MeshComponent->SetVisibility(false);
+
+	++NumInstancedItems;
+	SET_DWORD_STAT(STAT_ItemInstancedItems, NumInstancedItems);
+	return true;
+}
+
+void UItemInstancedRenderSubsystem::PromoteItem(AMasterItem* Item)
+{
+	if (!Item || !Item->IsInstanced())
+	{
+		return;
+	}
+
+	UStaticMesh* Mesh = Item->InstancedMesh;
+	const int32 InstanceIndex = Item->InstanceIndex;
+	Item->InstancedMesh = nullptr;
+	Item->InstanceIndex = INDEX_NONE;
+	RemoveInstance(Mesh, InstanceIndex);
+
+	// Devolver mesh e colisão ao ator; item assentado volta ao repouso kinematic, sem religar a simulação
+	if (UStaticMeshComponent* MeshComponent = Item->GetStaticMeshComponent())
+	{
+		MeshComponent->SetVisibility(true);
+		UItemPhysicsSubsystem::SetBodySimulating(MeshComponent, !Item->bPhysicsResting);
+	}
+
+	--NumInstancedItems;
+	SET_DWORD_STAT(STAT_ItemInstancedItems, NumInstancedItems);
+}
+
+int32 UItemInstancedRenderSubsystem::AddInstance(UStaticMesh* Mesh, const FTransform& Transform, const FItemInstanceOwner& Owner)
+{
+	UHierarchicalInstancedStaticMeshComponent* BatchComponent = Mesh ? GetOrCreateBatchComponent(Mesh) : nullptr;
+	if (!BatchComponent)
+	{
+		return INDEX_NONE;
+	}
+
+	FItemInstanceBatch& Batch = Batches.FindChecked(Mesh);
+	const int32 InstanceIndex = BatchComponent->AddInstance(Transform, true);
+	if (Batch.Owners.Num() <= InstanceIndex)
+	{
+		Batch.Owners.SetNum(InstanceIndex + 1);
+	}
+	Batch.Owners[InstanceIndex] = Owner;
+	return InstanceIndex;
+}
+
+void UItemInstancedRenderSubsystem::UpdateInstance(UStaticMesh* Mesh, int32 InstanceIndex, const FTransform& Transform)
+{
+	FItemInstanceBatch* Batch = Mesh ? Batches.Find(Mesh) : nullptr;
+	if (Batch && Batch->Component && Batch->Owners.IsValidIndex(InstanceIndex))
+	{
+		Batch->Component->UpdateInstanceTransform(InstanceIndex, Transform, true, true, true);
+	}
+}
+
+void UItemInstancedRenderSubsystem::RemoveInstance(UStaticMesh* Mesh, int32 InstanceIndex)
+{
+	FItemInstanceBatch* Batch = Mesh ? Batches.Find(Mesh) : nullptr;
+	if (!Batch || !Batch->Component || !Batch->Owners.IsValidIndex(InstanceIndex))
+	{
+		return;
+	}
+
+	// Remoção com swap: a última instância ocupa o lugar da removida, mantendo os índices dos donos consistentes
+	const int32 LastIndex = Batch->Owners.Num() - 1;
+	if (InstanceIndex != LastIndex)
+	{
+		FTransform LastTransform;
+		Batch->Component->GetInstanceTransform(LastIndex, LastTransform, true);
+		Batch->Component->UpdateInstanceTransform(InstanceIndex, LastTransform, true, false, true);
+
+		Batch->Owners[InstanceIndex] = Batch->Owners[LastIndex];
+		const FItemInstanceOwner& MovedOwner = Batch->Owners[InstanceIndex];
+		if (AMasterItem* MovedItem = MovedOwner.Item.Get())
+		{
+			MovedItem->InstanceIndex = InstanceIndex;
+		}
+		else if (MovedOwner.RecordKey != 0)
+		{
+			if (UItemWorldListSubsystem* WorldList = GetWorld()->GetSubsystem<UItemWorldListSubsystem>())
+			{
+				WorldList->OnRecordInstanceMoved(MovedOwner.RecordKey, InstanceIndex);
+			}
+		}
+	}
+
+	Batch->Component->RemoveInstance(LastIndex);
+	Batch->Owners.Pop(false);
+}
+
+UHierarchicalInstancedStaticMeshComponent* UItemInstancedRenderSubsystem::GetOrCreateBatchComponent(UStaticMesh* Mesh)
+{
+	if (FItemInstanceBatch* Batch = Batches.Find(Mesh))
+	{
+		return Batch->Component;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	if (!InstanceHost)
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.ObjectFlags |= RF_Transient;
+		InstanceHost = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParameters);
+		if (!InstanceHost)
+		{
+			return nullptr;
+		}
+
+		USceneComponent* HostRoot = NewObject<USceneComponent>(InstanceHost, TEXT("Root"));
+		InstanceHost->SetRootComponent(HostRoot);
+		HostRoot->RegisterComponent();
+	}
+
+	// Instâncias são apenas visuais: a interação continua com o AMasterItem (ou espera o servidor acordar o item da lista)
+	UHierarchicalInstancedStaticMeshComponent* Component = NewObject<UHierarchicalInstancedStaticMeshComponent>(InstanceHost);
+	Component->SetStaticMesh(Mesh);
+	Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Component->SetMobility(EComponentMobility::Movable);
+	Component->SetupAttachment(InstanceHost->GetRootComponent());
+	Component->RegisterComponent();
+
+	FItemInstanceBatch& NewBatch = Batches.Add(Mesh);
+	NewBatch.Component = Component;
+
+	SET_DWORD_STAT(STAT_ItemInstanceBatches, Batches.Num());
+	return Component;
+}
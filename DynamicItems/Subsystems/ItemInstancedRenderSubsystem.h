@@ -0,0 +1,73 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemInstancedRender
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ItemInstancedRenderSubsystem.generated.h"
+
+class AActor;
+class AMasterItem;
+class UStaticMesh;
+class UHierarchicalInstancedStaticMeshComponent;
+
+// Dono de uma instância: um item colapsado ou um registro da lista replicada (UItemWorldListSubsystem)
+struct FItemInstanceOwner
+{
+	TWeakObjectPtr<AMasterItem> Item;
+	uint64 RecordKey = 0;
+};
+
+USTRUCT()
+struct FItemInstanceBatch
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TObjectPtr<UHierarchicalInstancedStaticMeshComponent> Component;
+
+	// Dono de cada instância, no mesmo índice da instância no componente
+	TArray<FItemInstanceOwner> Owners;
+};
+
+/**
+ * Renderização instanciada dos itens parados no chão
+ * Itens em repouso com o mesmo StaticMesh viram instâncias de um único HISM (um draw call, sem corpo físico)
+ * O item volta a ser um AMasterItem completo quando um player entra no alcance de interação
+ * Os registros da lista replicada usam os mesmos batches: um HISM por mesh no mundo inteiro
+ */
+UCLASS()
+class ANDROMEDA_API UItemInstancedRenderSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// Esconde o mesh do item, desliga a física e adiciona uma instância no lugar
+	bool CollapseItem(AMasterItem* Item);
+
+	// Remove a instância e devolve mesh e física ao item
+	void PromoteItem(AMasterItem* Item);
+
+	// Batch compartilhado por mesh; AddInstance retorna INDEX_NONE se o batch não pôde ser criado
+	int32 AddInstance(UStaticMesh* Mesh, const FTransform& Transform, const FItemInstanceOwner& Owner);
+	void UpdateInstance(UStaticMesh* Mesh, int32 InstanceIndex, const FTransform& Transform);
+	// Remoção com swap: o dono da última instância recebe o índice removido
+	void RemoveInstance(UStaticMesh* Mesh, int32 InstanceIndex);
+
+	FORCEINLINE int32 GetNumInstancedItems() const { return NumInstancedItems; }
+
+private:
+	UHierarchicalInstancedStaticMeshComponent* GetOrCreateBatchComponent(UStaticMesh* Mesh);
+
+	UPROPERTY(Transient)
+	TObjectPtr<AActor> InstanceHost;
+
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UStaticMesh>, FItemInstanceBatch> Batches;
+
+	int32 NumInstancedItems = 0;
+};
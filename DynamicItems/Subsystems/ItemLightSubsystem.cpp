@@ -0,0 +1,140 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemLight
+
+#include "ItemLightSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/MasterItem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/ItemStats.h"
+#include "AndromedaSystemsC/DynamicItems/Data/ItemDefinition.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Light Budget"), STAT_ItemLightBudget, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Item Lights"), STAT_ItemLightActive, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Suppressed Item Lights"), STAT_ItemLightSuppressed, STATGROUP_AndromedaItems);
+
+static TAutoConsoleVariable<int32> CVarItemMaxActiveLights(
+	TEXT("andromeda.Items.MaxActiveLights"),
+	8,
+	TEXT("Número máximo de spotlights de itens acesos ao mesmo tempo; os demais usam o fallback emissivo."),
+	ECVF_Scalability);
+
+static TAutoConsoleVariable<float> CVarItemLightRarityWeight(
+	TEXT("andromeda.Items.LightRarityWeight"),
+	0.5f,
+	TEXT("Peso da raridade na prioridade das luzes: a distância é dividida por (1 + Raridade * Peso)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarItemLightRebalanceInterval(
+	TEXT("andromeda.Items.LightRebalanceInterval"),
+	0.1f,
+	TEXT("Intervalo em segundos entre reavaliações do orçamento de luzes."),
+	ECVF_Default);
+
+bool UItemLightSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Servidor dedicado não renderiza luzes
+	return Super::ShouldCreateSubsystem(Outer) && !IsRunningDedicatedServer();
+}
+
+void UItemLightSubsystem::Deinitialize()
+{
+	Requests.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UItemLightSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UItemLightSubsystem, STATGROUP_Tickables);
+}
+
+void UItemLightSubsystem::RequestLight(AMasterItem* Item)
+{
+	if (!Item || Requests.ContainsByPredicate([Item](const FLightRequest& Request) { return Request.Item.Get() == Item; }))
+	{
+		return;
+	}
+
+	// Começa no fallback emissivo; o próximo rebalanceamento decide se ganha o spotlight
+	FLightRequest& Request = Requests.AddDefaulted_GetRef();
+	Request.Item = Item;
+	Item->SetEmissiveFallback(true);
+	TimeUntilRebalance = 0.0f;
+}
+
+void UItemLightSubsystem::ReleaseLight(AMasterItem* Item)
+{
+	const int32 Index = Requests.IndexOfByPredicate([Item](const FLightRequest& Request) { return Request.Item.Get() == Item; });
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (Requests[Index].bHasLight)
+	{
+		Item->SetLightActive(false);
+		TimeUntilRebalance = 0.0f;
+	}
+	Item->SetEmissiveFallback(false);
+	Requests.RemoveAtSwap(Index, 1, false);
+}
+
+void UItemLightSubsystem::Tick(float DeltaTime)
+{
+	TimeUntilRebalance -= DeltaTime;
+	if (TimeUntilRebalance <= 0.0f)
+	{
+		TimeUntilRebalance = CVarItemLightRebalanceInterval.GetValueOnGameThread();
+		RebalanceLights();
+	}
+}
+
+void UItemLightSubsystem::RebalanceLights()
+{
+	SCOPE_CYCLE_COUNTER(STAT_ItemLightBudget);
+
+	Requests.RemoveAllSwap([](const FLightRequest& Request) { return !Request.Item.IsValid(); });
+	if (Requests.Num() == 0)
+	{
+		SET_DWORD_STAT(STAT_ItemLightActive, 0);
+		SET_DWORD_STAT(STAT_ItemLightSuppressed, 0);
+		return;
+	}
+
+	FVector ViewLocation = FVector::ZeroVector;
+	if (APlayerController* PlayerController = GetWorld()->GetFirstPlayerController())
+	{
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+	}
+
+	// Prioridade: mais perto e mais raro primeiro
+	const float RarityWeight = CVarItemLightRarityWeight.GetValueOnGameThread();
+	TArray<TPair<float, int32>> Ranking;
+	Ranking.Reserve(Requests.Num());
+	for (int32 Index = 0; Index < Requests.Num(); ++Index)
+	{
+		const AMasterItem* Item = Requests[Index].Item.Get();
+		const UItemDefinition* Definition = Item->GetDefinition();
+		const float Rarity = Definition ? static_cast<float>(Definition->STInfos.Rarity) : 0.0f;
+		Ranking.Emplace(FVector::Dist(Item->GetActorLocation(), ViewLocation) / (1.0f + Rarity * RarityWeight), Index);
+	}
+	Ranking.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key < B.Key; });
+
+	const int32 MaxActiveLights = FMath::Max(0, CVarItemMaxActiveLights.GetValueOnGameThread());
+	for (int32 Rank = 0; Rank < Ranking.Num(); ++Rank)
+	{
+		FLightRequest& Request = Requests[Ranking[Rank].Value];
+		const bool bShouldHaveLight = Rank < MaxActiveLights;
+		if (Request.bHasLight != bShouldHaveLight)
+		{
+			Request.bHasLight = bShouldHaveLight;
+			AMasterItem* Item = Request.Item.Get();
+			Item->SetLightActive(bShouldHaveLight);
+			Item->SetEmissiveFallback(!bShouldHaveLight);
+		}
+	}
+
+	SET_DWORD_STAT(STAT_ItemLightActive, FMath::Min(MaxActiveLights, Requests.Num()));
+	SET_DWORD_STAT(STAT_ItemLightSuppressed, FMath::Max(0, Requests.Num() - MaxActiveLights));
+}
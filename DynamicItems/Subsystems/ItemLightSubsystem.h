@@ -0,0 +1,50 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemLight
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ItemLightSubsystem.generated.h"
+
+class AMasterItem;
+
+/**
+ * Orçamento de luzes dos itens
+ * Só os N itens mais relevantes (distância à câmera local e raridade) recebem um spotlight real
+ * Os demais usam o fallback emissivo via Custom Primitive Data
+ */
+UCLASS()
+class ANDROMEDA_API UItemLightSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Índice inicial do Custom Primitive Data lido pelos materiais dos itens (RGB = cor, A = intensidade)
+	static constexpr int32 EmissiveCustomDataIndex = 0;
+
+	// USubsystem
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Chamados pelo item quando a luz deve acender/apagar
+	void RequestLight(AMasterItem* Item);
+	void ReleaseLight(AMasterItem* Item);
+
+	FORCEINLINE int32 GetNumRequests() const { return Requests.Num(); }
+
+private:
+	struct FLightRequest
+	{
+		TWeakObjectPtr<AMasterItem> Item;
+		bool bHasLight = false;
+	};
+
+	void RebalanceLights();
+
+	TArray<FLightRequest> Requests;
+	float TimeUntilRebalance = 0.0f;
+};
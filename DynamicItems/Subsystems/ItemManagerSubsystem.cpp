@@ -0,0 +1,815 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemManager
+
+#include "ItemManagerSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/MasterItem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/ItemStats.h"
+#include "AndromedaSystemsC/DynamicItems/Diagnostics/ItemTrace.h"
+#include "AndromedaSystemsC/DynamicItems/Data/ItemDefinition.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemDefinitionRegistry.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Engine/StaticMesh.h"
+#include "Components/ActorComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "RenderCore.h"
+
+DECLARE_CYCLE_STAT(TEXT("ItemManager Tick"), STAT_ItemManagerTick, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Registered Items"), STAT_ItemManagerRegisteredItems, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Awake Items"), STAT_ItemManagerAwakeItems, STATGROUP_AndromedaItems);
+DECLARE_CYCLE_STAT(TEXT("Significance Update"), STAT_ItemSignificanceUpdate, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Significance Near"), STAT_ItemSignificanceNear, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Significance Mid"), STAT_ItemSignificanceMid, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Significance Far"), STAT_ItemSignificanceFar, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Significance Offscreen"), STAT_ItemSignificanceOffscreen, STATGROUP_AndromedaItems);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Item Updates"), STAT_ItemManagerItemUpdates, STATGROUP_AndromedaItems);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Update Cost per Item (us)"), STAT_ItemManagerUpdateCostPerItem, STATGROUP_AndromedaItems);
+DECLARE_CYCLE_STAT(TEXT("Hover Kernel"), STAT_ItemHoverKernel, STATGROUP_AndromedaItems);
+DECLARE_CYCLE_STAT(TEXT("Hover Kernel Apply"), STAT_ItemHoverKernelApply, STATGROUP_AndromedaItems);
+
+static TAutoConsoleVariable<bool> CVarItemBatchedTick(
+	TEXT("andromeda.Items.BatchedTick"),
+	true,
+	TEXT("Se verdadeiro, os itens são atualizados em lote pelo UItemManagerSubsystem.\n")
+	TEXT("Se falso, cada AMasterItem volta a usar o próprio Tick (apenas para comparação de custo)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarItemServerProfile(
+	TEXT("andromeda.Items.ServerProfile"),
+	true,
+	TEXT("Se verdadeiro, em servidor dedicado os itens não flutuam, não giram e não pedem luz: quantidade, ID, alcance de pickup e cooldowns apenas.\n")
+	TEXT("Flutuação e rotação ficam só nos clientes. Compare \"stat AndromedaItems\" e Andromeda.Items.ActorMemory no servidor com 1 e 0."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarItemHoverKernel(
+	TEXT("andromeda.Items.HoverKernel"),
+	true,
+	TEXT("Se verdadeiro, flutuação e rotação dos itens em modo cosmético são calculadas em lote (FItemHoverKernel, SoA)\n")
+	TEXT("e aplicadas aos proxies em um único passe no fim do Tick. Se falso, cada item usa UpdateFloating/UpdateRotation."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarItemHoverKernelParallel(
+	TEXT("andromeda.Items.HoverKernelParallel"),
+	true,
+	TEXT("Se verdadeiro, o FItemHoverKernel divide os itens em blocos processados pelo ParallelFor (a partir de 2 blocos)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarItemSignificance(
+	TEXT("andromeda.Items.Significance"),
+	true,
+	TEXT("Se verdadeiro, itens acordados são atualizados com frequência reduzida conforme o tier de significância.\n")
+	TEXT("Se falso, todos os itens acordados atualizam a cada frame (apenas para comparação de custo)."),
+	ECVF_Scalability);
+
+static TAutoConsoleVariable<FString> CVarItemSignificanceDistances(
+	TEXT("andromeda.Items.SignificanceDistances"),
+	TEXT("1500,4000"),
+	TEXT("Limites Near,Mid em unidades. A distância à view mais próxima é dividida por (1 + Raridade * SignificanceRarityWeight).\n")
+	TEXT("Acima de Mid o item é Far; fora do cone de visão de todos os players locais é Offscreen."),
+	ECVF_Scalability);
+
+static TAutoConsoleVariable<FString> CVarItemSignificanceIntervals(
+	TEXT("andromeda.Items.SignificanceIntervals"),
+	TEXT("0,0.066,0.2,0.5"),
+	TEXT("Intervalo de atualização em segundos por tier (Near,Mid,Far,Offscreen). 0 = todo frame; negativo = efeitos pausados no tier."),
+	ECVF_Scalability);
+
+static TAutoConsoleVariable<float> CVarItemSignificanceRarityWeight(
+	TEXT("andromeda.Items.SignificanceRarityWeight"),
+	0.25f,
+	TEXT("Peso da raridade na significância: itens raros continuam Near/Mid a distâncias maiores."),
+	ECVF_Scalability);
+
+static TAutoConsoleVariable<float> CVarItemSignificanceUpdateInterval(
+	TEXT("andromeda.Items.SignificanceUpdateInterval"),
+	0.25f,
+	TEXT("Intervalo em segundos entre recálculos dos tiers de significância."),
+	ECVF_Default);
+
+// Tempo máximo entregue a um item em um único update (evita saltos de rotação após longos períodos pausado)
+static constexpr float MaxItemPendingDeltaTime = 1.0f;
+
+// Lê até NumValues floats separados por vírgula; valores ausentes mantêm o que já está em OutValues
+static void ParseSignificanceList(const FString& Text, float* OutValues, int32 NumValues)
+{
+	TArray<FString> Parts;
+	Text.ParseIntoArray(Parts, TEXT(","));
+	for (int32 Index = 0; Index < FMath::Min(Parts.Num(), NumValues); ++Index)
+	{
+		OutValues[Index] = FCString::Atof(*Parts[Index].TrimStartAndEnd());
+	}
+}
+
+static const FName ItemBenchmarkTag(TEXT("ItemBenchmark"));
+
+// Spawna N itens em grade ao redor do player, em EasyMode para que todos fiquem ativos
+// Compare "stat AndromedaItems" e "stat game" com andromeda.Items.BatchedTick 1 e 0 (medição automática: Andromeda.Items.TickBenchmark)
+static FAutoConsoleCommandWithWorldAndArgs GItemBenchmarkCommand(
+	TEXT("Andromeda.Items.Benchmark"),
+	TEXT("Andromeda.Items.Benchmark <Count> - Spawna Count itens ativos (ex: 1000, 10000, 50000) para medir o custo por frame"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World)
+		{
+			return;
+		}
+
+		const int32 Count = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000;
+
+		const FVector Origin = UItemManagerSubsystem::GetFirstPlayerLocation(World);
+		UItemManagerSubsystem::SpawnBenchmarkItems(World, Origin, Count);
+
+		UE_LOG(LogTemp, Log, TEXT("UItemManagerSubsystem: %d itens de benchmark spawnados (BatchedTick=%d)"), Count, UItemManagerSubsystem::IsBatchedTickEnabled() ? 1 : 0);
+	}));
+
+// Antes/depois automático: spawna cada quantidade, mede com andromeda.Items.BatchedTick 1 e 0 e registra no log
+// Game thread inclui o despacho dos Ticks dos atores; atualização dos itens é só o trabalho de cada caminho
+static FAutoConsoleCommandWithWorldAndArgs GItemTickBenchmarkCommand(
+	TEXT("Andromeda.Items.TickBenchmark"),
+	TEXT("Andromeda.Items.TickBenchmark [Frames=300] [Counts=1000,10000,50000] - Mede o custo por frame em lote e por ator para cada quantidade"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UItemManagerSubsystem* ItemManager = World ? World->GetSubsystem<UItemManagerSubsystem>() : nullptr;
+		if (!ItemManager)
+		{
+			return;
+		}
+
+		const int32 FramesPerRun = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 300;
+		TArray<int32> Counts = { 1000, 10000, 50000 };
+		if (Args.Num() > 1)
+		{
+			TArray<FString> Parts;
+			Args[1].ParseIntoArray(Parts, TEXT(","));
+			Counts.Reset();
+			for (const FString& Part : Parts)
+			{
+				Counts.Add(FMath::Max(1, FCString::Atoi(*Part)));
+			}
+		}
+
+		ItemManager->StartTickBenchmark(Counts, FramesPerRun);
+	}));
+
+// Só o kernel, sem atores: dados sintéticos em EasyMode (flutuando e girando), média de Iterations execuções
+// Ponta a ponta: Andromeda.Items.Benchmark 10000 e "stat AndromedaItems" com andromeda.Items.HoverKernel 1 e 0
+static FAutoConsoleCommandWithArgs GItemHoverKernelBenchmarkCommand(
+	TEXT("Andromeda.Items.HoverKernelBenchmark"),
+	TEXT("Andromeda.Items.HoverKernelBenchmark <Count> [Iterations] - Mede o FItemHoverKernel isolado, em uma thread e com ParallelFor"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 Count = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10000;
+		const int32 Iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 100;
+
+		FRandomStream Random(Count);
+		FItemHoverKernel Kernel;
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			const FRotator Rotation(0.0f, Random.FRandRange(-180.0f, 180.0f), 0.0f);
+			const EDirectionRotation Axis = static_cast<EDirectionRotation>(Index % 3);
+			Kernel.Add(1.0f / 60.0f, Random.FRandRange(0.0f, 50.0f), 50.0f, 2.0f, Rotation, 90.0f, Axis, 5.0f,
+				FItemHoverKernel::Float | FItemHoverKernel::Rotate | FItemHoverKernel::EasyMode);
+		}
+
+		for (const bool bParallel : { false, true })
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				Kernel.Run(bParallel);
+			}
+			const double AverageMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) / Iterations;
+
+			UE_LOG(LogTemp, Log, TEXT("FItemHoverKernel: %d itens, %s: %.4f ms por execução (%.2f ns por item)"),
+				Count, bParallel ? TEXT("ParallelFor") : TEXT("uma thread"), AverageMs, AverageMs * 1000000.0 / Count);
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("FItemHoverKernel: %d worker threads, blocos de %d itens"),
+			FTaskGraphInterface::Get().GetNumWorkerThreads(), FItemHoverKernel::ChunkSize);
+	}));
+
+static FAutoConsoleCommandWithWorld GItemClearBenchmarkCommand(
+	TEXT("Andromeda.Items.ClearBenchmark"),
+	TEXT("Destroi todos os itens spawnados por Andromeda.Items.Benchmark"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		UItemManagerSubsystem::DestroyBenchmarkItems(World);
+	}));
+
+// Custo de memória por item: UObjects (ator + componentes) e bytes próprios de cada um
+// Use junto com "stat slate" e "obj list class=WidgetComponent" para comparar configurações de item
+static FAutoConsoleCommandWithWorld GItemActorMemoryCommand(
+	TEXT("Andromeda.Items.ActorMemory"),
+	TEXT("Mostra a média de UObjects e bytes por AMasterItem no mundo, com a contagem de componentes por classe"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (!World)
+		{
+			return;
+		}
+
+		int32 NumItems = 0;
+		int64 NumObjects = 0;
+		int64 NumBytes = 0;
+		TMap<const UClass*, int32> ComponentsByClass;
+		for (TActorIterator<AMasterItem> It(World); It; ++It)
+		{
+			++NumItems;
+			++NumObjects;
+			NumBytes += It->GetClass()->GetStructureSize() + It->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+
+			for (UActorComponent* Component : It->GetComponents())
+			{
+				if (Component)
+				{
+					++NumObjects;
+					NumBytes += Component->GetClass()->GetStructureSize() + Component->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+					++ComponentsByClass.FindOrAdd(Component->GetClass());
+				}
+			}
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("UItemManagerSubsystem: %d itens, %.1f UObjects e %.1f KB por item (%.2f MB no total)"),
+			NumItems,
+			NumItems > 0 ? static_cast<double>(NumObjects) / NumItems : 0.0,
+			NumItems > 0 ? static_cast<double>(NumBytes) / NumItems / 1024.0 : 0.0,
+			static_cast<double>(NumBytes) / (1024.0 * 1024.0));
+
+		ComponentsByClass.ValueSort(TGreater<int32>());
+		for (const TPair<const UClass*, int32>& ClassCount : ComponentsByClass)
+		{
+			UE_LOG(LogTemp, Log, TEXT("UItemManagerSubsystem:   %s x %d"), *ClassCount.Key->GetName(), ClassCount.Value);
+		}
+	}));
+
+bool UItemManagerSubsystem::IsBatchedTickEnabled()
+{
+	return CVarItemBatchedTick.GetValueOnGameThread();
+}
+
+bool UItemManagerSubsystem::IsServerProfileActive(const UWorld* World)
+{
+	return World && World->GetNetMode() == NM_DedicatedServer && CVarItemServerProfile.GetValueOnGameThread();
+}
+
+FVector UItemManagerSubsystem::GetFirstPlayerLocation(const UWorld* World, float ForwardDistance)
+{
+	const APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+	if (const APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr)
+	{
+		return Pawn->GetActorLocation() + Pawn->GetActorForwardVector() * ForwardDistance;
+	}
+	return FVector::ZeroVector;
+}
+
+void UItemManagerSubsystem::SpawnBenchmarkItems(UWorld* World, const FVector& Origin, int32 Count)
+{
+	const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Count)));
+	const float Spacing = 150.0f;
+
+	// Definição transiente compartilhada por todos os itens de benchmark
+	UItemDefinitionRegistry* Registry = UItemDefinitionRegistry::Get(World);
+	UItemDefinition* BenchmarkDefinition = Registry ? Registry->FindDefinition(ItemBenchmarkTag) : nullptr;
+	if (!BenchmarkDefinition)
+	{
+		BenchmarkDefinition = NewObject<UItemDefinition>(GetTransientPackage(), TEXT("ItemBenchmarkDefinition"));
+		BenchmarkDefinition->ID = ItemBenchmarkTag;
+		BenchmarkDefinition->Name = TEXT("Benchmark");
+		BenchmarkDefinition->STModel.StaticMesh = TSoftObjectPtr<UStaticMesh>(FSoftObjectPath(TEXT("/Engine/BasicShapes/Cube.Cube")));
+		BenchmarkDefinition->BasicInfos.EasyMode = true;
+		if (Registry)
+		{
+			Registry->RegisterDefinition(BenchmarkDefinition);
+		}
+	}
+
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const FVector Location = Origin + FVector((Index % GridSize) * Spacing, (Index / GridSize) * Spacing, 100.0f);
+		AMasterItem* Item = World->SpawnActorDeferred<AMasterItem>(AMasterItem::StaticClass(), FTransform(Location));
+		if (!Item)
+		{
+			continue;
+		}
+
+		Item->InitializeItem(BenchmarkDefinition, 1);
+		Item->Tags.Add(ItemBenchmarkTag);
+		Item->FinishSpawning(FTransform(Location));
+	}
+}
+
+void UItemManagerSubsystem::DestroyBenchmarkItems(UWorld* World)
+{
+	if (!World)
+	{
+		return;
+	}
+
+	for (TActorIterator<AMasterItem> It(World); It; ++It)
+	{
+		if (It->ActorHasTag(ItemBenchmarkTag))
+		{
+			It->Destroy();
+		}
+	}
+}
+
+void UItemManagerSubsystem::StartTickBenchmark(const TArray<int32>& Counts, int32 FramesPerRun)
+{
+	if (Counts.Num() == 0 || TickBenchmarkRun != INDEX_NONE)
+	{
+		return;
+	}
+
+	TickBenchmarkCounts = Counts;
+	TickBenchmarkFramesPerRun = FMath::Max(1, FramesPerRun);
+	bTickBenchmarkOriginalBatched = IsBatchedTickEnabled();
+	TickBenchmarkRun = 0;
+	BeginTickBenchmarkRun();
+}
+
+void UItemManagerSubsystem::BeginTickBenchmarkRun()
+{
+	if (TickBenchmarkRun >= TickBenchmarkCounts.Num() * 2)
+	{
+		DestroyBenchmarkItems(GetWorld());
+		CVarItemBatchedTick->Set(bTickBenchmarkOriginalBatched, ECVF_SetByConsole);
+		TickBenchmarkRun = INDEX_NONE;
+		UE_LOG(LogTemp, Log, TEXT("UItemManagerSubsystem: benchmark de Tick concluído"));
+		return;
+	}
+
+	// Nova quantidade a cada par de execuções; os mesmos atores são medidos nos dois caminhos
+	const bool bBatched = TickBenchmarkRun % 2 == 0;
+	if (bBatched)
+	{
+		DestroyBenchmarkItems(GetWorld());
+		SpawnBenchmarkItems(GetWorld(), GetFirstPlayerLocation(GetWorld()), TickBenchmarkCounts[TickBenchmarkRun / 2]);
+	}
+	CVarItemBatchedTick->Set(bBatched, ECVF_SetByConsole);
+	TickBenchmarkFrame = 0;
+}
+
+void UItemManagerSubsystem::UpdateTickBenchmark()
+{
+	if (TickBenchmarkRun == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Frames de aquecimento: spawn, carregamento do mesh e troca do caminho de Tick
+	static constexpr int32 WarmupFrames = 30;
+	++TickBenchmarkFrame;
+	if (TickBenchmarkFrame <= WarmupFrames)
+	{
+		TickBenchmarkGameThreadMs = 0.0;
+		ItemTickCycles = 0;
+		return;
+	}
+
+	TickBenchmarkGameThreadMs += FPlatformTime::ToMilliseconds(GGameThreadTime);
+	if (TickBenchmarkFrame < WarmupFrames + TickBenchmarkFramesPerRun)
+	{
+		return;
+	}
+
+	const int32 NumFrames = TickBenchmarkFramesPerRun;
+	UE_LOG(LogTemp, Log, TEXT("UItemManagerSubsystem: %6d itens, BatchedTick=%d: game thread %.3f ms/frame, atualização dos itens %.3f ms/frame (%d acordados)"),
+		TickBenchmarkCounts[TickBenchmarkRun / 2], TickBenchmarkRun % 2 == 0 ? 1 : 0,
+		TickBenchmarkGameThreadMs / NumFrames, FPlatformTime::ToMilliseconds64(ItemTickCycles) / NumFrames, NumAwakeItems);
+
+	++TickBenchmarkRun;
+	BeginTickBenchmarkRun();
+}
+
+void UItemManagerSubsystem::Deinitialize()
+{
+	for (AMasterItem* Item : Items)
+	{
+		if (Item)
+		{
+			Item->ItemManagerIndex = INDEX_NONE;
+		}
+	}
+
+	Items.Reset();
+	States.Reset();
+	NumAwakeItems = 0;
+
+	// Benchmark interrompido (troca de mapa): devolver o caminho de Tick escolhido pelo usuário
+	if (TickBenchmarkRun != INDEX_NONE)
+	{
+		CVarItemBatchedTick->Set(bTickBenchmarkOriginalBatched, ECVF_SetByConsole);
+		TickBenchmarkRun = INDEX_NONE;
+	}
+
+	Super::Deinitialize();
+}
+
+TStatId UItemManagerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UItemManagerSubsystem, STATGROUP_Tickables);
+}
+
+void UItemManagerSubsystem::RegisterItem(AMasterItem* Item)
+{
+	if (!Item || Item->ItemManagerIndex != INDEX_NONE)
+	{
+		return;
+	}
+
+	// Todo item entra dormindo; BeginPlay acorda se necessário
+	// No caminho legado não há dormência: o ator tica todo frame, como o Tick original
+	Item->ItemManagerIndex = Items.Add(Item);
+	States.AddDefaulted();
+
+	Item->SetActorTickEnabled(!IsBatchedTickEnabled());
+}
+
+void UItemManagerSubsystem::UnregisterItem(AMasterItem* Item)
+{
+	if (!Item || !Items.IsValidIndex(Item->ItemManagerIndex) || Items[Item->ItemManagerIndex] != Item)
+	{
+		return;
+	}
+
+	int32 Index = Item->ItemManagerIndex;
+
+	// Manter a partição acordados/dormindo: mover para o fim do bloco acordado antes de remover
+	if (Index < NumAwakeItems)
+	{
+		SwapEntries(Index, NumAwakeItems - 1);
+		--NumAwakeItems;
+		Index = NumAwakeItems;
+	}
+
+	SwapEntries(Index, Items.Num() - 1);
+	Items.Pop(false);
+	States.Pop(false);
+
+	Item->ItemManagerIndex = INDEX_NONE;
+	Item->SetActorTickEnabled(false);
+}
+
+void UItemManagerSubsystem::WakeItem(AMasterItem* Item)
+{
+	if (!Item || !Items.IsValidIndex(Item->ItemManagerIndex) || Item->ItemManagerIndex < NumAwakeItems)
+	{
+		return;
+	}
+
+	SwapEntries(Item->ItemManagerIndex, NumAwakeItems);
+	States[NumAwakeItems].PendingDeltaTime = 0.0f;
+	++NumAwakeItems;
+
+	// No caminho legado o próprio ator volta a tickar
+	Item->SetActorTickEnabled(!IsBatchedTickEnabled());
+	Item->OnWokeUp();
+}
+
+void UItemManagerSubsystem::SleepItem(int32 Index)
+{
+	if (Index < 0 || Index >= NumAwakeItems)
+	{
+		return;
+	}
+
+	AMasterItem* Item = Items[Index];
+	SwapEntries(Index, NumAwakeItems - 1);
+	--NumAwakeItems;
+
+	if (Item)
+	{
+		Item->SetActorTickEnabled(false);
+		Item->OnFellAsleep();
+	}
+}
+
+bool UItemManagerSubsystem::IsItemAwake(const AMasterItem* Item) const
+{
+	return Item && Item->ItemManagerIndex != INDEX_NONE && Item->ItemManagerIndex < NumAwakeItems;
+}
+
+void UItemManagerSubsystem::SwapEntries(int32 IndexA, int32 IndexB)
+{
+	if (IndexA == IndexB)
+	{
+		return;
+	}
+
+	Items.Swap(IndexA, IndexB);
+	States.Swap(IndexA, IndexB);
+
+	if (Items[IndexA])
+	{
+		Items[IndexA]->ItemManagerIndex = IndexA;
+	}
+	if (Items[IndexB])
+	{
+		Items[IndexB]->ItemManagerIndex = IndexB;
+	}
+}
+
+FItemRuntimeState* UItemManagerSubsystem::GetRuntimeState(const AMasterItem* Item)
+{
+	return Item && States.IsValidIndex(Item->ItemManagerIndex) ? &States[Item->ItemManagerIndex] : nullptr;
+}
+
+void UItemManagerSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ItemManagerTick);
+	SET_DWORD_STAT(STAT_ItemManagerRegisteredItems, Items.Num());
+	SET_DWORD_STAT(STAT_ItemManagerAwakeItems, NumAwakeItems);
+
+	UpdateTickBenchmark();
+	const uint64 TickStartCycles = FPlatformTime::Cycles64();
+
+	// Sincronizar o Tick dos atores quando a CVar é alterada em runtime
+	// Legado: todos os itens ticam. De volta ao lote: acordar todos para que voltem ao repouso pelo passe
+	const bool bBatched = IsBatchedTickEnabled();
+	if (bBatched != bBatchedTickActive)
+	{
+		bBatchedTickActive = bBatched;
+		const TArray<AMasterItem*> AllItems(Items);
+		for (AMasterItem* Item : AllItems)
+		{
+			if (Item)
+			{
+				Item->SetActorTickEnabled(!bBatched);
+				if (bBatched)
+				{
+					WakeItem(Item);
+				}
+			}
+		}
+	}
+
+	if (!bBatched)
+	{
+		return;
+	}
+
+	// Perfil de servidor: itens acordados só mantêm o alcance de pickup, não há o que escalonar por significância
+	const bool bUseSignificance = CVarItemSignificance.GetValueOnGameThread() && !IsServerProfileActive(GetWorld());
+	if (bUseSignificance)
+	{
+		TimeUntilSignificanceUpdate -= DeltaTime;
+		if (TimeUntilSignificanceUpdate <= 0.0f)
+		{
+			TimeUntilSignificanceUpdate = CVarItemSignificanceUpdateInterval.GetValueOnGameThread();
+			UpdateSignificance();
+		}
+	}
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	int32 NumUpdates = 0;
+
+	const bool bUseHoverKernel = CVarItemHoverKernel.GetValueOnGameThread();
+	HoverKernel.Reset();
+	HoverKernelItems.Reset();
+
+	// Iterar de trás para frente: se o item atual dormir ou sair do registro, o swap traz um item já processado
+	for (int32 Index = NumAwakeItems - 1; Index >= 0; --Index)
+	{
+		if (!bUseSignificance)
+		{
+			if (!bUseHoverKernel || !QueueHoverKernel(Index, DeltaTime))
+			{
+				TickItem(Index, DeltaTime);
+			}
+			++NumUpdates;
+			continue;
+		}
+
+		// Itens menos significativos acumulam o tempo e atualizam com o intervalo do tier
+		// As interpolações do item são exponenciais, então um passo longo equivale a vários curtos
+		FItemRuntimeState& State = States[Index];
+		State.PendingDeltaTime = FMath::Min(State.PendingDeltaTime + DeltaTime, MaxItemPendingDeltaTime);
+
+		const float TierInterval = TierUpdateIntervals[static_cast<int32>(State.Significance)];
+		if (TierInterval < 0.0f || State.PendingDeltaTime < TierInterval)
+		{
+			continue;
+		}
+
+		const float ItemDeltaTime = State.PendingDeltaTime;
+		State.PendingDeltaTime = 0.0f;
+		if (!bUseHoverKernel || !QueueHoverKernel(Index, ItemDeltaTime))
+		{
+			TickItem(Index, ItemDeltaTime);
+		}
+		++NumUpdates;
+	}
+
+	if (HoverKernel.Num() > 0)
+	{
+		RunHoverKernel();
+	}
+
+	if (NumUpdates > 0)
+	{
+		SET_FLOAT_STAT(STAT_ItemManagerUpdateCostPerItem, FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000.0 / NumUpdates);
+	}
+	ItemTickCycles += FPlatformTime::Cycles64() - TickStartCycles;
+}
+
+bool UItemManagerSubsystem::QueueHoverKernel(int32 Index, float DeltaTime)
+{
+	AMasterItem* Item = Items[Index];
+	if (!IsValid(Item))
+	{
+		return false;
+	}
+
+	FItemRuntimeState& State = States[Index];
+	if (!Item->PrepareHoverKernel(State))
+	{
+		return false;
+	}
+
+	INC_DWORD_STAT(STAT_ItemManagerItemUpdates);
+
+	const UItemDefinition* Definition = Item->Definition;
+	uint8 Flags = 0;
+	Flags |= Definition->FloatingSettings.Floating ? FItemHoverKernel::Float : 0;
+	Flags |= Definition->RotationSettings.Rotate ? FItemHoverKernel::Rotate : 0;
+	Flags |= Definition->RotationSettings.Reset ? FItemHoverKernel::ResetRotation : 0;
+	Flags |= Item->bEasyMode ? FItemHoverKernel::EasyMode : 0;
+	Flags |= State.bIsRotating ? FItemHoverKernel::Rotating : 0;
+	Flags |= State.bIsResettingRotation ? FItemHoverKernel::Resetting : 0;
+
+	HoverKernel.Add(DeltaTime,
+		State.VisualHeight, Definition->FloatingSettings.Height, Definition->FloatingSettings.FloatingTransitionSpeed,
+		State.CurrentRotation, Definition->RotationSettings.RotationSpeed, Definition->RotationSettings.DirectionRotation,
+		Definition->RotationSettings.ResetSpeed, Flags);
+	HoverKernelItems.Add(Item);
+	return true;
+}
+
+void UItemManagerSubsystem::RunHoverKernel()
+{
+	{
+		SCOPE_CYCLE_COUNTER(STAT_ItemHoverKernel);
+		HoverKernel.Run(CVarItemHoverKernelParallel.GetValueOnGameThread());
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_ItemHoverKernelApply);
+
+	// Os índices do manager podem ter mudado (SleepItem de outros itens no mesmo passe): resolver pelo item
+	for (int32 Entry = 0; Entry < HoverKernelItems.Num(); ++Entry)
+	{
+		AMasterItem* Item = HoverKernelItems[Entry];
+		if (!IsValid(Item) || !States.IsValidIndex(Item->ItemManagerIndex))
+		{
+			continue;
+		}
+
+		FItemRuntimeState& State = States[Item->ItemManagerIndex];
+		const uint8 Flags = HoverKernel.GetFlags(Entry);
+		if (Flags & FItemHoverKernel::Float)
+		{
+			if (!State.bIsFloating)
+			{
+				ITEM_TRACE(FloatStart, Item, 1);
+			}
+			State.bIsFloating = true;
+			State.VisualHeight = HoverKernel.GetHeight(Entry);
+		}
+		if (Flags & FItemHoverKernel::Rotate)
+		{
+			if (Flags & FItemHoverKernel::CapturedOriginal)
+			{
+				State.OriginalRotation = State.CurrentRotation;
+			}
+			const bool bIsRotating = (Flags & FItemHoverKernel::Rotating) != 0;
+			const bool bIsResetting = (Flags & FItemHoverKernel::Resetting) != 0;
+			if (bIsResetting && !State.bIsResettingRotation)
+			{
+				ITEM_TRACE(RotateReset, Item, 0);
+			}
+			if (bIsRotating && !State.bIsRotating)
+			{
+				ITEM_TRACE(RotateStart, Item, 0);
+			}
+			State.CurrentRotation = HoverKernel.GetRotation(Entry);
+			State.bIsRotating = bIsRotating;
+			State.bIsResettingRotation = bIsResetting;
+		}
+
+		Item->ApplyVisualTransform(State);
+	}
+
+	HoverKernelItems.Reset();
+}
+
+void UItemManagerSubsystem::UpdateSignificance()
+{
+	SCOPE_CYCLE_COUNTER(STAT_ItemSignificanceUpdate);
+
+	float TierDistances[2] = { 1500.0f, 4000.0f };
+	ParseSignificanceList(CVarItemSignificanceDistances.GetValueOnGameThread(), TierDistances, UE_ARRAY_COUNT(TierDistances));
+	ParseSignificanceList(CVarItemSignificanceIntervals.GetValueOnGameThread(), TierUpdateIntervals, UE_ARRAY_COUNT(TierUpdateIntervals));
+	const float RarityWeight = CVarItemSignificanceRarityWeight.GetValueOnGameThread();
+
+	// Views de todos os players; só as locais têm cone de visão (no servidor as remotas contam só pela distância)
+	struct FSignificanceView
+	{
+		FVector Location;
+		FVector Direction;
+		float MinDot; // Cosseno do meio-ângulo do cone; -1 = sem teste de cone
+	};
+	TArray<FSignificanceView, TInlineAllocator<4>> Views;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (!PlayerController)
+		{
+			continue;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		float MinDot = -1.0f;
+		if (PlayerController->IsLocalController() && PlayerController->PlayerCameraManager)
+		{
+			// Meio FOV horizontal com folga: o cone cobre o frustum inteiro, sem pop nas bordas
+			const float HalfAngle = FMath::Min(PlayerController->PlayerCameraManager->GetFOVAngle() * 0.5f + 15.0f, 89.0f);
+			MinDot = FMath::Cos(FMath::DegreesToRadians(HalfAngle));
+		}
+		Views.Add({ ViewLocation, ViewRotation.Vector(), MinDot });
+	}
+
+	FMemory::Memzero(NumItemsPerTier, sizeof(NumItemsPerTier));
+	for (int32 Index = 0; Index < NumAwakeItems; ++Index)
+	{
+		const AMasterItem* Item = Items[Index];
+		FItemRuntimeState& State = States[Index];
+		if (!Item || Views.Num() == 0 || Item->OverlappingPlayers.Num() > 0)
+		{
+			// Sem views (ex: servidor sem players) ou com player interagindo: sempre atualização completa
+			State.Significance = EItemSignificance::Near;
+			++NumItemsPerTier[static_cast<int32>(State.Significance)];
+			continue;
+		}
+
+		const FVector ItemLocation = Item->GetActorLocation();
+		float MinDistance = TNumericLimits<float>::Max();
+		bool bIsVisible = false;
+		for (const FSignificanceView& View : Views)
+		{
+			const FVector ToItem = ItemLocation - View.Location;
+			const float Distance = ToItem.Size();
+			MinDistance = FMath::Min(MinDistance, Distance);
+			bIsVisible |= View.MinDot <= -1.0f || Distance <= TierDistances[0] || FVector::DotProduct(ToItem / FMath::Max(Distance, 1.0f), View.Direction) >= View.MinDot;
+		}
+
+		const UItemDefinition* Definition = Item->GetDefinition();
+		const float Rarity = Definition ? static_cast<float>(Definition->STInfos.Rarity) : 0.0f;
+		const float WeightedDistance = MinDistance / (1.0f + Rarity * RarityWeight);
+
+		if (!bIsVisible)
+		{
+			State.Significance = EItemSignificance::Offscreen;
+		}
+		else if (WeightedDistance <= TierDistances[0])
+		{
+			State.Significance = EItemSignificance::Near;
+		}
+		else if (WeightedDistance <= TierDistances[1])
+		{
+			State.Significance = EItemSignificance::Mid;
+		}
+		else
+		{
+			State.Significance = EItemSignificance::Far;
+		}
+		++NumItemsPerTier[static_cast<int32>(State.Significance)];
+	}
+
+	SET_DWORD_STAT(STAT_ItemSignificanceNear, NumItemsPerTier[static_cast<int32>(EItemSignificance::Near)]);
+	SET_DWORD_STAT(STAT_ItemSignificanceMid, NumItemsPerTier[static_cast<int32>(EItemSignificance::Mid)]);
+	SET_DWORD_STAT(STAT_ItemSignificanceFar, NumItemsPerTier[static_cast<int32>(EItemSignificance::Far)]);
+	SET_DWORD_STAT(STAT_ItemSignificanceOffscreen, NumItemsPerTier[static_cast<int32>(EItemSignificance::Offscreen)]);
+}
+
+void UItemManagerSubsystem::TickItem(int32 Index, float DeltaTime)
+{
+	AMasterItem* Item = Items.IsValidIndex(Index) ? Items[Index].Get() : nullptr;
+	if (!IsValid(Item))
+	{
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_ItemManagerItemUpdates);
+
+	// UpdateItem retorna falso quando o item terminou de voltar ao repouso e pode dormir
+	if (!Item->UpdateItem(DeltaTime, States[Index]))
+	{
+		SleepItem(Index);
+	}
+}
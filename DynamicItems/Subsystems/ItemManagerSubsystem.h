@@ -0,0 +1,146 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemManager
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/ItemHoverKernel.h"
+#include "ItemManagerSubsystem.generated.h"
+
+class AMasterItem;
+class ACharacter;
+
+/**
+ * Tiers de significância: definem a frequência de atualização dos efeitos de um item acordado
+ * Calculados a partir da distância às views dos players, do cone de visão local e da raridade
+ */
+enum class EItemSignificance : uint8
+{
+	Near,
+	Mid,
+	Far,
+	Offscreen,
+	Num
+};
+
+/**
+ * Estado de runtime de floating, rotação e luz de um item
+ * Fica em array contíguo no UItemManagerSubsystem, não no ator
+ */
+struct FItemRuntimeState
+{
+	FVector OriginalLocation = FVector::ZeroVector;
+	FRotator OriginalRotation = FRotator::ZeroRotator;
+	FRotator CurrentRotation = FRotator::ZeroRotator;
+	bool bIsFloating = false;
+	bool bIsRotating = false;
+	bool bIsResettingRotation = false;
+	bool bIsLightOn = false;
+
+	// Modo cosmético: bob e spin aplicados ao proxy visual, o root fica parado
+	bool bUsingVisualProxy = false;
+	float VisualHeight = 0.0f; // Altura do proxy acima do root
+
+	// LOD de atualização: o tempo acumulado é entregue inteiro no próximo update do item
+	EItemSignificance Significance = EItemSignificance::Near;
+	float PendingDeltaTime = 0.0f;
+};
+
+/**
+ * Subsystem que atualiza todos os AMasterItem do mundo em um único passe por frame
+ * Substitui o Tick individual de cada ator
+ * Itens ociosos ficam dormindo e não custam nada até serem acordados por um evento
+ */
+UCLASS()
+class ANDROMEDA_API UItemManagerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Registro de itens (chamado em BeginPlay/EndPlay do item)
+	void RegisterItem(AMasterItem* Item);
+	void UnregisterItem(AMasterItem* Item);
+
+	// Atualiza um único item e o coloca para dormir quando terminar (passe em lote)
+	void TickItem(int32 Index, float DeltaTime);
+
+	// Dormência: itens dormindo saem do passe por frame até serem acordados
+	// Acordar: overlap de player, fim de cooldown ou mudança de EasyMode
+	void WakeItem(AMasterItem* Item);
+	bool IsItemAwake(const AMasterItem* Item) const;
+
+	FItemRuntimeState* GetRuntimeState(const AMasterItem* Item);
+
+	FORCEINLINE int32 GetNumItems() const { return Items.Num(); }
+	FORCEINLINE int32 GetNumAwakeItems() const { return NumAwakeItems; }
+	FORCEINLINE int32 GetNumItemsInTier(EItemSignificance Tier) const { return NumItemsPerTier[static_cast<int32>(Tier)]; }
+
+	// Se falso, cada item volta a usar seu próprio Tick (para comparação de custo)
+	static bool IsBatchedTickEnabled();
+
+	// Servidor dedicado com andromeda.Items.ServerProfile: só dados autoritativos, nenhum trabalho de apresentação
+	static bool IsServerProfileActive(const UWorld* World);
+
+	// Benchmark: spawna Count itens em grade a partir de Origin (Andromeda.Items.Benchmark)
+	static void SpawnBenchmarkItems(UWorld* World, const FVector& Origin, int32 Count);
+	static void DestroyBenchmarkItems(UWorld* World);
+
+	// Andromeda.Items.TickBenchmark: cada quantidade de Counts nos dois caminhos (BatchedTick 1 e 0), FramesPerRun frames medidos em cada
+	void StartTickBenchmark(const TArray<int32>& Counts, int32 FramesPerRun);
+
+	// Caminho legado: custo do Tick de cada ator, somado ao do passe em lote para o benchmark
+	FORCEINLINE void AddItemTickCycles(uint64 Cycles) { ItemTickCycles += Cycles; }
+
+	// Comandos de console: posição do pawn do primeiro player, ForwardDistance à frente dele (origem do mundo sem pawn)
+	static FVector GetFirstPlayerLocation(const UWorld* World, float ForwardDistance = 0.0f);
+
+private:
+	void SleepItem(int32 Index);
+	void SwapEntries(int32 IndexA, int32 IndexB);
+
+	// Caminho em lote do modo cosmético (andromeda.Items.HoverKernel)
+	// Falso: o item não está no caso estável do proxy e segue por TickItem
+	bool QueueHoverKernel(int32 Index, float DeltaTime);
+	void RunHoverKernel();
+
+	// Recalcula o tier dos itens acordados (a cada andromeda.Items.SignificanceUpdateInterval)
+	void UpdateSignificance();
+
+	void BeginTickBenchmarkRun();
+	void UpdateTickBenchmark();
+
+	// Arrays paralelos, indexados por AMasterItem::ItemManagerIndex
+	// Itens acordados ficam em [0, NumAwakeItems), dormindo no restante
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AMasterItem>> Items;
+
+	TArray<FItemRuntimeState> States;
+
+	int32 NumAwakeItems = 0;
+	bool bBatchedTickActive = true;
+
+	// Preenchidos e consumidos dentro do Tick (ponteiros crus, sem GC no meio); HoverKernelItems[i] é a entrada i do kernel
+	FItemHoverKernel HoverKernel;
+	TArray<AMasterItem*> HoverKernelItems;
+
+	// Significância
+	float TimeUntilSignificanceUpdate = 0.0f;
+	float TierUpdateIntervals[static_cast<int32>(EItemSignificance::Num)] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	int32 NumItemsPerTier[static_cast<int32>(EItemSignificance::Num)] = { 0, 0, 0, 0 };
+
+	// Benchmark de Tick: execução 2 * i é a quantidade i em lote, 2 * i + 1 a mesma quantidade no caminho legado
+	TArray<int32> TickBenchmarkCounts;
+	int32 TickBenchmarkRun = INDEX_NONE;
+	int32 TickBenchmarkFrame = 0;
+	int32 TickBenchmarkFramesPerRun = 0;
+	bool bTickBenchmarkOriginalBatched = true;
+	double TickBenchmarkGameThreadMs = 0.0;
+	uint64 ItemTickCycles = 0;
+};
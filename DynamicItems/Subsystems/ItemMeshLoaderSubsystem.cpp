@@ -0,0 +1,123 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemMeshLoader
+
+#include "ItemMeshLoaderSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/MasterItem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/ItemStats.h"
+#include "Engine/AssetManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Mesh Load Completion"), STAT_ItemMeshLoadCompletion, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pending Mesh Loads"), STAT_ItemMeshPendingLoads, STATGROUP_AndromedaItems);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Coalesced Mesh Requests"), STAT_ItemMeshCoalescedRequests, STATGROUP_AndromedaItems);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Last Mesh Load Latency (ms)"), STAT_ItemMeshLoadLatency, STATGROUP_AndromedaItems);
+
+void UItemMeshLoaderSubsystem::Deinitialize()
+{
+	for (TPair<FSoftObjectPath, FPendingMeshLoad>& PendingLoad : PendingLoads)
+	{
+		if (PendingLoad.Value.Handle.IsValid())
+		{
+			PendingLoad.Value.Handle->CancelHandle();
+		}
+	}
+	PendingLoads.Reset();
+
+	Super::Deinitialize();
+}
+
+void UItemMeshLoaderSubsystem::RequestMesh(const FSoftObjectPath& MeshPath, int32 Priority, AMasterItem* Requester)
+{
+	if (MeshPath.IsNull() || !Requester)
+	{
+		return;
+	}
+
+	bool bIsNewLoad = false;
+	FindOrAddPendingLoad(MeshPath, bIsNewLoad).Requesters.Add(Requester);
+	if (bIsNewLoad)
+	{
+		StartLoad(MeshPath, Priority);
+	}
+}
+
+void UItemMeshLoaderSubsystem::RequestMesh(const FSoftObjectPath& MeshPath, int32 Priority, FOnItemMeshLoaded OnLoaded)
+{
+	if (MeshPath.IsNull() || !OnLoaded.IsBound())
+	{
+		return;
+	}
+
+	bool bIsNewLoad = false;
+	FindOrAddPendingLoad(MeshPath, bIsNewLoad).Callbacks.Add(MoveTemp(OnLoaded));
+	if (bIsNewLoad)
+	{
+		StartLoad(MeshPath, Priority);
+	}
+}
+
+void UItemMeshLoaderSubsystem::CancelRequest(AMasterItem* Requester)
+{
+	for (TPair<FSoftObjectPath, FPendingMeshLoad>& PendingLoad : PendingLoads)
+	{
+		PendingLoad.Value.Requesters.RemoveAllSwap([Requester](const TWeakObjectPtr<AMasterItem>& Item) { return Item.Get() == Requester; });
+	}
+}
+
+UItemMeshLoaderSubsystem::FPendingMeshLoad& UItemMeshLoaderSubsystem::FindOrAddPendingLoad(const FSoftObjectPath& MeshPath, bool& bOutIsNew)
+{
+	// Já existe um carregamento pendente para este caminho: apenas entrar na fila dele
+	if (FPendingMeshLoad* PendingLoad = PendingLoads.Find(MeshPath))
+	{
+		bOutIsNew = false;
+		INC_DWORD_STAT(STAT_ItemMeshCoalescedRequests);
+		return *PendingLoad;
+	}
+
+	bOutIsNew = true;
+	FPendingMeshLoad& NewLoad = PendingLoads.Add(MeshPath);
+	NewLoad.RequestTime = FPlatformTime::Seconds();
+	return NewLoad;
+}
+
+void UItemMeshLoaderSubsystem::StartLoad(const FSoftObjectPath& MeshPath, int32 Priority)
+{
+	FStreamableManager& StreamableManager = UAssetManager::GetStreamableManager();
+	TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(
+		MeshPath,
+		FStreamableDelegate::CreateUObject(this, &UItemMeshLoaderSubsystem::OnLoadCompleted, MeshPath),
+		Priority);
+
+	// O handle pode completar de forma síncrona (asset já carregado) e já ter removido a entrada
+	if (FPendingMeshLoad* PendingLoad = PendingLoads.Find(MeshPath))
+	{
+		PendingLoad->Handle = Handle;
+	}
+
+	SET_DWORD_STAT(STAT_ItemMeshPendingLoads, PendingLoads.Num());
+}
+
+void UItemMeshLoaderSubsystem::OnLoadCompleted(FSoftObjectPath MeshPath)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ItemMeshLoadCompletion);
+
+	FPendingMeshLoad CompletedLoad;
+	if (!PendingLoads.RemoveAndCopyValue(MeshPath, CompletedLoad))
+	{
+		return;
+	}
+
+	SET_FLOAT_STAT(STAT_ItemMeshLoadLatency, (FPlatformTime::Seconds() - CompletedLoad.RequestTime) * 1000.0);
+	SET_DWORD_STAT(STAT_ItemMeshPendingLoads, PendingLoads.Num());
+
+	UObject* LoadedObject = MeshPath.ResolveObject();
+	for (const TWeakObjectPtr<AMasterItem>& Requester : CompletedLoad.Requesters)
+	{
+		if (AMasterItem* Item = Requester.Get())
+		{
+			Item->OnMeshLoaded(MeshPath, LoadedObject);
+		}
+	}
+	for (const FOnItemMeshLoaded& Callback : CompletedLoad.Callbacks)
+	{
+		Callback.ExecuteIfBound(LoadedObject);
+	}
+}
@@ -0,0 +1,53 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemMeshLoader
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/StreamableManager.h"
+#include "ItemMeshLoaderSubsystem.generated.h"
+
+class AMasterItem;
+
+DECLARE_DELEGATE_OneParam(FOnItemMeshLoaded, UObject* /*LoadedObject*/);
+
+/**
+ * Carregamento assíncrono dos meshes dos itens via FStreamableManager
+ * Pedidos para o mesmo caminho enquanto o carregamento está pendente são agrupados em um único request
+ */
+UCLASS()
+class ANDROMEDA_API UItemMeshLoaderSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem
+	virtual void Deinitialize() override;
+
+	// Pede o mesh em MeshPath; Requester->OnMeshLoaded é chamado quando o carregamento termina
+	void RequestMesh(const FSoftObjectPath& MeshPath, int32 Priority, AMasterItem* Requester);
+
+	// Mesmo agrupamento para quem não é um AMasterItem (ex: apresentação da lista replicada no cliente)
+	void RequestMesh(const FSoftObjectPath& MeshPath, int32 Priority, FOnItemMeshLoaded OnLoaded);
+
+	// Remove o item de todos os pedidos pendentes (item indo para o pool); o carregamento continua para os demais
+	void CancelRequest(AMasterItem* Requester);
+
+	FORCEINLINE int32 GetNumPendingLoads() const { return PendingLoads.Num(); }
+
+private:
+	struct FPendingMeshLoad
+	{
+		TSharedPtr<FStreamableHandle> Handle;
+		TArray<TWeakObjectPtr<AMasterItem>> Requesters;
+		TArray<FOnItemMeshLoaded> Callbacks;
+		double RequestTime = 0.0;
+	};
+
+	// Entrada pendente do caminho; bOutIsNew indica que StartLoad ainda precisa ser chamado
+	FPendingMeshLoad& FindOrAddPendingLoad(const FSoftObjectPath& MeshPath, bool& bOutIsNew);
+	void StartLoad(const FSoftObjectPath& MeshPath, int32 Priority);
+	void OnLoadCompleted(FSoftObjectPath MeshPath);
+
+	TMap<FSoftObjectPath, FPendingMeshLoad> PendingLoads;
+};
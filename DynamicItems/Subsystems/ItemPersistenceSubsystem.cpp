@@ -0,0 +1,403 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemPersistence
+
+#include "ItemPersistenceSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/MasterItem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/ItemStats.h"
+#include "AndromedaSystemsC/DynamicItems/Data/ItemDefinition.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemBatchSpawnSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemDefinitionRegistry.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemPoolSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemRegistrySubsystem.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Persistence Update"), STAT_ItemPersistenceUpdate, STATGROUP_AndromedaItems);
+DECLARE_CYCLE_STAT(TEXT("Persistence Dehydrate"), STAT_ItemPersistenceDehydrate, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Persistent Item Records"), STAT_ItemPersistenceRecords, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Loaded Item Cells"), STAT_ItemPersistenceLoadedCells, STATGROUP_AndromedaItems);
+
+static TAutoConsoleVariable<bool> CVarItemPersistence(
+	TEXT("andromeda.Items.Persistence"),
+	true,
+	TEXT("Se verdadeiro, itens longe de todos os players viram registros por célula e só voltam a ser atores quando a célula é carregada."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarItemPersistenceCellSize(
+	TEXT("andromeda.Items.PersistenceCellSize"),
+	12800.0f,
+	TEXT("Tamanho da célula de persistência (unidades). Lido quando o mundo começa; use o tamanho de célula do World Partition."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarItemPersistenceLoadRadius(
+	TEXT("andromeda.Items.PersistenceLoadRadius"),
+	25600.0f,
+	TEXT("Células a até esta distância (2D) de algum player são carregadas. Use o loading range do World Partition."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarItemPersistenceUnloadMargin(
+	TEXT("andromeda.Items.PersistenceUnloadMargin"),
+	3200.0f,
+	TEXT("Folga além do LoadRadius antes de desidratar uma célula (evita carregar e descarregar na borda)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarItemPersistenceUpdateInterval(
+	TEXT("andromeda.Items.PersistenceUpdateInterval"),
+	0.5f,
+	TEXT("Intervalo em segundos entre recálculos das células carregadas."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarItemPersistenceMaxDehydratePerFrame(
+	TEXT("andromeda.Items.PersistenceMaxDehydratePerFrame"),
+	256,
+	TEXT("Máximo de atores desidratados por frame; o restante fica para os próximos frames."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorld GItemPersistenceStatsCommand(
+	TEXT("Andromeda.Items.PersistenceStats"),
+	TEXT("Mostra células carregadas, registros desidratados, memória dos registros e atores residentes"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UItemPersistenceSubsystem* Persistence = World ? World->GetSubsystem<UItemPersistenceSubsystem>() : nullptr)
+		{
+			Persistence->LogStats();
+		}
+	}));
+
+bool UItemPersistenceSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Registros e atores de itens são do servidor, como o UItemPoolSubsystem
+	const UWorld* World = Cast<UWorld>(Outer);
+	return Super::ShouldCreateSubsystem(Outer) && (!World || World->GetNetMode() != NM_Client);
+}
+
+void UItemPersistenceSubsystem::Deinitialize()
+{
+	DehydratedCells.Reset();
+	LoadedCells.Reset();
+	AdoptedPlacedItems.Reset();
+	PendingDehydration.Reset();
+	bHasStreamingSources = false;
+	NumRecords = 0;
+
+	Super::Deinitialize();
+}
+
+TStatId UItemPersistenceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UItemPersistenceSubsystem, STATGROUP_Tickables);
+}
+
+FIntPoint UItemPersistenceSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+bool UItemPersistenceSubsystem::IsLocationLoaded(const FVector& Location) const
+{
+	return !bHasStreamingSources || LoadedCells.Contains(GetCell(Location));
+}
+
+FName UItemPersistenceSubsystem::GetPlacedItemKey(const AMasterItem* Item)
+{
+	// Caminho do ator no pacote do nível / célula: o mesmo a cada vez que a célula é carregada
+	return FName(*Item->GetPathName());
+}
+
+void UItemPersistenceSubsystem::Tick(float DeltaTime)
+{
+	if (!CVarItemPersistence.GetValueOnGameThread())
+	{
+		return;
+	}
+
+	TimeUntilUpdate -= DeltaTime;
+	if (TimeUntilUpdate <= 0.0f)
+	{
+		TimeUntilUpdate = CVarItemPersistenceUpdateInterval.GetValueOnGameThread();
+		UpdateLoadedCells();
+	}
+
+	if (PendingDehydration.Num() > 0)
+	{
+		ProcessPendingDehydration();
+	}
+}
+
+void UItemPersistenceSubsystem::GatherCellsInRange(const FVector& Source, float Radius, TSet<FIntPoint>& OutCells) const
+{
+	const FIntPoint MinCell = GetCell(Source - FVector(Radius, Radius, 0.0f));
+	const FIntPoint MaxCell = GetCell(Source + FVector(Radius, Radius, 0.0f));
+	const double RadiusSquared = FMath::Square(static_cast<double>(Radius));
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			// Distância 2D da fonte até o retângulo da célula
+			const double DeltaX = FMath::Max3(X * static_cast<double>(CellSize) - Source.X, 0.0, Source.X - (X + 1) * static_cast<double>(CellSize));
+			const double DeltaY = FMath::Max3(Y * static_cast<double>(CellSize) - Source.Y, 0.0, Source.Y - (Y + 1) * static_cast<double>(CellSize));
+			if (DeltaX * DeltaX + DeltaY * DeltaY <= RadiusSquared)
+			{
+				OutCells.Add(FIntPoint(X, Y));
+			}
+		}
+	}
+}
+
+void UItemPersistenceSubsystem::UpdateLoadedCells()
+{
+	SCOPE_CYCLE_COUNTER(STAT_ItemPersistenceUpdate);
+
+	// Fontes de streaming: views de todos os players (no servidor as remotas vêm do pawn / control rotation)
+	TArray<FVector, TInlineAllocator<8>> Sources;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (const APlayerController* PlayerController = It->Get())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			Sources.Add(ViewLocation);
+		}
+	}
+
+	if (Sources.Num() == 0)
+	{
+		// Sem players nada é desidratado; registros existentes esperam a próxima fonte
+		bHasStreamingSources = false;
+		LoadedCells.Reset();
+		return;
+	}
+
+	// Registros existentes ficam indexados pelo tamanho antigo: só trocar com a grade vazia
+	if (!bHasStreamingSources && DehydratedCells.Num() == 0)
+	{
+		CellSize = FMath::Max(1000.0f, CVarItemPersistenceCellSize.GetValueOnGameThread());
+	}
+
+	const float LoadRadius = FMath::Max(0.0f, CVarItemPersistenceLoadRadius.GetValueOnGameThread());
+	const float KeepRadius = LoadRadius + FMath::Max(0.0f, CVarItemPersistenceUnloadMargin.GetValueOnGameThread());
+
+	TSet<FIntPoint> NewLoadedCells;
+	TSet<FIntPoint> KeepCells;
+	for (const FVector& Source : Sources)
+	{
+		GatherCellsInRange(Source, LoadRadius, NewLoadedCells);
+		GatherCellsInRange(Source, KeepRadius, KeepCells);
+	}
+
+	if (!bHasStreamingSources)
+	{
+		// Primeira fonte: até aqui tudo estava carregado, varrer uma única vez os itens já existentes
+		bHasStreamingSources = true;
+		for (TActorIterator<AMasterItem> It(GetWorld()); It; ++It)
+		{
+			if (!It->IsInPool() && !NewLoadedCells.Contains(GetCell(It->GetActorLocation())))
+			{
+				PendingDehydration.Add(*It);
+			}
+		}
+	}
+	else
+	{
+		for (const FIntPoint& Cell : LoadedCells)
+		{
+			if (!KeepCells.Contains(Cell))
+			{
+				QueueCellDehydration(Cell);
+			}
+		}
+	}
+
+	// Histerese: células entre LoadRadius e KeepRadius mantêm o estado anterior
+	TSet<FIntPoint> PreviousCells = MoveTemp(LoadedCells);
+	LoadedCells = PreviousCells.Intersect(KeepCells);
+	for (const FIntPoint& Cell : NewLoadedCells)
+	{
+		bool bAlreadyLoaded = false;
+		LoadedCells.Add(Cell, &bAlreadyLoaded);
+		if (!bAlreadyLoaded)
+		{
+			MaterializeCell(Cell);
+		}
+	}
+
+	SET_DWORD_STAT(STAT_ItemPersistenceLoadedCells, LoadedCells.Num());
+}
+
+void UItemPersistenceSubsystem::QueueCellDehydration(const FIntPoint& Cell)
+{
+	UItemRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UItemRegistrySubsystem>();
+	if (!Registry)
+	{
+		return;
+	}
+
+	// O registro consulta por esfera 3D: raio de uma célula inteira cobre o quadrado e um desnível de ~0.7 célula
+	const FVector Center((Cell.X + 0.5f) * CellSize, (Cell.Y + 0.5f) * CellSize, 0.0f);
+	TArray<AMasterItem*> Items;
+	Registry->FindItemsInRange(Center, CellSize, FItemRegistryFilter(), Items);
+	for (AMasterItem* Item : Items)
+	{
+		if (Item && GetCell(Item->GetActorLocation()) == Cell)
+		{
+			PendingDehydration.Add(Item);
+		}
+	}
+}
+
+void UItemPersistenceSubsystem::ProcessPendingDehydration()
+{
+	SCOPE_CYCLE_COUNTER(STAT_ItemPersistenceDehydrate);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const int32 MaxPerFrame = FMath::Max(1, CVarItemPersistenceMaxDehydratePerFrame.GetValueOnGameThread());
+	int32 NumProcessed = 0;
+	while (PendingDehydration.Num() > 0 && NumProcessed < MaxPerFrame)
+	{
+		AMasterItem* Item = PendingDehydration.Pop(false).Get();
+		++NumProcessed;
+
+		// A célula pode ter voltado a carregar enquanto o item esperava na fila
+		if (IsValid(Item) && !Item->IsInPool() && !IsLocationLoaded(Item->GetActorLocation()))
+		{
+			DehydrateItem(Item);
+		}
+	}
+
+	WorstDehydrateFrameMs = FMath::Max(WorstDehydrateFrameMs, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void UItemPersistenceSubsystem::DehydrateItem(AMasterItem* Item)
+{
+	FItemPersistentRecord Record;
+	Record.ID = Item->GetItemID();
+	Record.Quantity = Item->GetQuantity();
+	Record.Transform = Item->GetActorTransform();
+	DehydratedCells.FindOrAdd(GetCell(Record.Transform.GetLocation())).Add(Record);
+	++NumRecords;
+	++NumDehydratedTotal;
+	SET_DWORD_STAT(STAT_ItemPersistenceRecords, NumRecords);
+
+	// O pool destrói os atores do nível em vez de guardá-los
+	if (UItemPoolSubsystem* Pool = GetWorld()->GetSubsystem<UItemPoolSubsystem>())
+	{
+		Pool->ReleaseItem(Item);
+	}
+	else
+	{
+		Item->Destroy();
+	}
+}
+
+void UItemPersistenceSubsystem::MaterializeCell(const FIntPoint& Cell)
+{
+	TArray<FItemPersistentRecord> Records;
+	if (!DehydratedCells.RemoveAndCopyValue(Cell, Records))
+	{
+		return;
+	}
+
+	NumRecords -= Records.Num();
+	SET_DWORD_STAT(STAT_ItemPersistenceRecords, NumRecords);
+
+	UItemDefinitionRegistry* DefinitionRegistry = UItemDefinitionRegistry::Get(GetWorld());
+	if (!DefinitionRegistry)
+	{
+		return;
+	}
+
+	TArray<FItemSpawnRequest> Requests;
+	Requests.Reserve(Records.Num());
+	for (const FItemPersistentRecord& Record : Records)
+	{
+		UItemDefinition* Definition = DefinitionRegistry->FindDefinition(Record.ID);
+		if (!Definition)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("UItemPersistenceSubsystem: definição '%s' não encontrada, registro descartado"), *Record.ID.ToString());
+			continue;
+		}
+
+		FItemSpawnRequest& Request = Requests.AddDefaulted_GetRef();
+		Request.Definition = Definition;
+		Request.Quantity = Record.Quantity;
+		Request.Transform = Record.Transform;
+	}
+	NumMaterializedTotal += Requests.Num();
+
+	// Fatiado por frame (andromeda.Items.SpawnBudgetMs): carregar uma célula cheia de loot não vira um pico
+	if (UItemBatchSpawnSubsystem* BatchSpawn = GetWorld()->GetSubsystem<UItemBatchSpawnSubsystem>())
+	{
+		BatchSpawn->SpawnItemsBatch(Requests);
+	}
+}
+
+bool UItemPersistenceSubsystem::AdoptPlacedItem(AMasterItem* Item)
+{
+	if (!Item || !Item->HasAnyFlags(RF_WasLoaded) || !CVarItemPersistence.GetValueOnGameThread())
+	{
+		return false;
+	}
+
+	// Já adotado: o estado atual está em um registro ou em um ator recriado (ou foi pego), a cópia do nível sobra
+	bool bAlreadyAdopted = false;
+	AdoptedPlacedItems.Add(GetPlacedItemKey(Item), &bAlreadyAdopted);
+	if (bAlreadyAdopted)
+	{
+		Item->Destroy();
+		return true;
+	}
+
+	if (IsLocationLoaded(Item->GetActorLocation()))
+	{
+		return false;
+	}
+
+	DehydrateItem(Item);
+	return true;
+}
+
+void UItemPersistenceSubsystem::OnPlacedItemRemoved(AMasterItem* Item)
+{
+	if (!Item || Item->IsInPool() || !Item->HasAnyFlags(RF_WasLoaded) || !AdoptedPlacedItems.Contains(GetPlacedItemKey(Item)))
+	{
+		return;
+	}
+
+	FItemPersistentRecord Record;
+	Record.ID = Item->GetItemID();
+	Record.Quantity = Item->GetQuantity();
+	Record.Transform = Item->GetActorTransform();
+
+	const FIntPoint Cell = GetCell(Record.Transform.GetLocation());
+	DehydratedCells.FindOrAdd(Cell).Add(Record);
+	++NumRecords;
+	SET_DWORD_STAT(STAT_ItemPersistenceRecords, NumRecords);
+
+	// O sublevel descarregou antes da nossa célula: o item volta como ator do nível persistente
+	if (IsLocationLoaded(Record.Transform.GetLocation()))
+	{
+		MaterializeCell(Cell);
+	}
+}
+
+void UItemPersistenceSubsystem::NotifyItemActivated(AMasterItem* Item)
+{
+	if (Item && bHasStreamingSources && !IsLocationLoaded(Item->GetActorLocation()))
+	{
+		PendingDehydration.Add(Item);
+	}
+}
+
+void UItemPersistenceSubsystem::LogStats() const
+{
+	const UItemRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UItemRegistrySubsystem>();
+	const SIZE_T RecordBytes = DehydratedCells.GetAllocatedSize() + NumRecords * sizeof(FItemPersistentRecord);
+
+	UE_LOG(LogTemp, Log, TEXT("UItemPersistenceSubsystem: %d células carregadas, %d registros em %d células (%.1f KB), %d itens residentes"),
+		LoadedCells.Num(), NumRecords, DehydratedCells.Num(), RecordBytes / 1024.0, Registry ? Registry->GetNumItems() : 0);
+	UE_LOG(LogTemp, Log, TEXT("UItemPersistenceSubsystem: %d desidratados, %d recriados, %d na fila, pior frame de desidratação %.3f ms, %d itens do nível adotados"),
+		NumDehydratedTotal, NumMaterializedTotal, PendingDehydration.Num(), WorstDehydrateFrameMs, AdoptedPlacedItems.Num());
+}
@@ -0,0 +1,90 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemPersistence
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ItemPersistenceSubsystem.generated.h"
+
+class AMasterItem;
+
+/**
+ * Registro leve de um item fora da área carregada: o suficiente para recriar o ator
+ */
+struct FItemPersistentRecord
+{
+	FName ID;
+	int32 Quantity = 1;
+	FTransform Transform;
+};
+
+/**
+ * Itens longe de todos os players viram registros por célula (grade XY de andromeda.Items.PersistenceCellSize)
+ * Quando a célula entra no raio de carregamento os atores voltam pelo UItemBatchSpawnSubsystem (pool, fatiado por frame);
+ * quando sai, os atores são desidratados aos poucos e devolvidos ao pool
+ * Itens colocados no nível são adotados no primeiro BeginPlay: a partir daí o estado deles vive aqui,
+ * e a cópia recarregada junto com a célula do World Partition / sublevel é descartada antes do setup
+ * Só existe com autoridade, como o pool
+ */
+UCLASS()
+class ANDROMEDA_API UItemPersistenceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// BeginPlay de um item colocado no nível; verdadeiro se o ator foi consumido (desidratado ou já adotado antes)
+	bool AdoptPlacedItem(AMasterItem* Item);
+
+	// EndPlay por streaming (RemovedFromWorld) de um item colocado já adotado: o estado vira registro
+	void OnPlacedItemRemoved(AMasterItem* Item);
+
+	// Item ativado (BeginPlay ou saída do pool) fora da área carregada: desidratado no próximo Tick
+	void NotifyItemActivated(AMasterItem* Item);
+
+	bool IsLocationLoaded(const FVector& Location) const;
+
+	FORCEINLINE int32 GetNumLoadedCells() const { return LoadedCells.Num(); }
+	FORCEINLINE int32 GetNumRecords() const { return NumRecords; }
+	FORCEINLINE int32 GetNumDehydratedCells() const { return DehydratedCells.Num(); }
+	void LogStats() const;
+
+private:
+	FIntPoint GetCell(const FVector& Location) const;
+
+	// Recalcula as células carregadas a partir das views dos players (a cada andromeda.Items.PersistenceUpdateInterval)
+	void UpdateLoadedCells();
+	void GatherCellsInRange(const FVector& Source, float Radius, TSet<FIntPoint>& OutCells) const;
+
+	void QueueCellDehydration(const FIntPoint& Cell);
+	void ProcessPendingDehydration();
+	void DehydrateItem(AMasterItem* Item);
+	void MaterializeCell(const FIntPoint& Cell);
+
+	static FName GetPlacedItemKey(const AMasterItem* Item);
+
+	TMap<FIntPoint, TArray<FItemPersistentRecord>> DehydratedCells;
+	TSet<FIntPoint> LoadedCells;
+
+	// Sem players ainda (início do mapa, servidor vazio) tudo conta como carregado
+	bool bHasStreamingSources = false;
+
+	// Itens colocados no nível que já passaram por AdoptPlacedItem (caminho do ator)
+	TSet<FName> AdoptedPlacedItems;
+
+	TArray<TWeakObjectPtr<AMasterItem>> PendingDehydration;
+
+	float CellSize = 12800.0f;
+	float TimeUntilUpdate = 0.0f;
+	int32 NumRecords = 0;
+	int32 NumDehydratedTotal = 0;
+	int32 NumMaterializedTotal = 0;
+	double WorstDehydrateFrameMs = 0.0;
+};
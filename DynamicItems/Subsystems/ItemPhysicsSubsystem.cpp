@@ -0,0 +1,324 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemPhysics
+
+#include "ItemPhysicsSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/MasterItem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/ItemStats.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Settle Detector"), STAT_ItemSettleDetector, STATGROUP_AndromedaItems);
+DECLARE_CYCLE_STAT(TEXT("Physics Toggle Flush"), STAT_ItemPhysicsToggleFlush, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Settling Items"), STAT_ItemSettlingItems, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Kinematic Resting Items"), STAT_ItemRestingItems, STATGROUP_AndromedaItems);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Physics Toggles"), STAT_ItemPhysicsToggles, STATGROUP_AndromedaItems);
+
+static TAutoConsoleVariable<bool> CVarItemKinematicRest(
+	TEXT("andromeda.Items.KinematicRest"),
+	true,
+	TEXT("Se verdadeiro, itens assentados param de simular e ficam kinematic/query-only até um impulso externo.\n")
+	TEXT("Se falso, continuam simulando parados no chão (apenas para comparação de custo)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarItemSettleLinearSpeed(
+	TEXT("andromeda.Items.SettleLinearSpeed"),
+	5.0f,
+	TEXT("Velocidade linear (cm/s) abaixo da qual o item é considerado parado."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarItemSettleAngularSpeed(
+	TEXT("andromeda.Items.SettleAngularSpeed"),
+	10.0f,
+	TEXT("Velocidade angular (graus/s) abaixo da qual o item é considerado parado."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarItemSettleTime(
+	TEXT("andromeda.Items.SettleTime"),
+	0.5f,
+	TEXT("Tempo contínuo (s) abaixo dos limites de velocidade até o item assentar."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarItemSettleCheckInterval(
+	TEXT("andromeda.Items.SettleCheckInterval"),
+	0.1f,
+	TEXT("Intervalo (s) entre leituras de velocidade do detector de repouso."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarItemMaxPhysicsTogglesPerFrame(
+	TEXT("andromeda.Items.MaxPhysicsTogglesPerFrame"),
+	128,
+	TEXT("Máximo de trocas de simulação aplicadas por frame; o restante fica para os próximos frames."),
+	ECVF_Default);
+
+// Campo de itens caindo para medir corpos ativos do Chaos e tempo da thread de física
+// Compare "stat AndromedaItems", "stat ChaosCounters" e "stat Chaos" com andromeda.Items.KinematicRest 1 e 0
+static FAutoConsoleCommandWithWorld GItemPhysicsStatsCommand(
+	TEXT("Andromeda.Items.PhysicsStats"),
+	TEXT("Mostra quantos itens estão simulando, assentando e em repouso kinematic"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		UItemPhysicsSubsystem* Physics = World ? World->GetSubsystem<UItemPhysicsSubsystem>() : nullptr;
+		if (!Physics)
+		{
+			return;
+		}
+
+		int32 NumItems = 0;
+		int32 NumSimulating = 0;
+		int32 NumAwakeBodies = 0;
+		for (TActorIterator<AMasterItem> It(World); It; ++It)
+		{
+			++NumItems;
+			if (const UPrimitiveComponent* Body = Cast<UPrimitiveComponent>(It->GetRootComponent()))
+			{
+				if (Body->IsSimulatingPhysics())
+				{
+					++NumSimulating;
+					NumAwakeBodies += Body->RigidBodyIsAwake() ? 1 : 0;
+				}
+			}
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("UItemPhysicsSubsystem: %d itens, %d simulando (%d corpos acordados), %d assentando, %d em repouso kinematic (KinematicRest=%d)"),
+			NumItems, NumSimulating, NumAwakeBodies, Physics->GetNumTrackedItems(), Physics->GetNumRestingItems(), UItemPhysicsSubsystem::IsKinematicRestEnabled() ? 1 : 0);
+	}));
+
+bool UItemPhysicsSubsystem::IsKinematicRestEnabled()
+{
+	return CVarItemKinematicRest.GetValueOnGameThread();
+}
+
+void UItemPhysicsSubsystem::SetBodySimulating(UPrimitiveComponent* Body, bool bSimulate)
+{
+	if (!Body)
+	{
+		return;
+	}
+
+	// Em repouso o corpo continua bloqueando traces e o player, mas sai da simulação do Chaos
+	Body->SetCollisionEnabled(bSimulate ? ECollisionEnabled::QueryAndPhysics : ECollisionEnabled::QueryOnly);
+	if (Body->IsSimulatingPhysics() != bSimulate)
+	{
+		Body->SetSimulatePhysics(bSimulate);
+		INC_DWORD_STAT(STAT_ItemPhysicsToggles);
+	}
+}
+
+void UItemPhysicsSubsystem::Deinitialize()
+{
+	for (const FSettleEntry& Entry : Tracked)
+	{
+		if (AMasterItem* Item = Entry.Item.Get())
+		{
+			Item->SettleIndex = INDEX_NONE;
+		}
+	}
+	for (const FPendingToggle& Toggle : PendingToggles)
+	{
+		if (AMasterItem* Item = Toggle.Item.Get())
+		{
+			Item->PendingPhysicsToggle = INDEX_NONE;
+		}
+	}
+
+	Tracked.Reset();
+	PendingToggles.Reset();
+	NumRestingItems = 0;
+
+	Super::Deinitialize();
+}
+
+TStatId UItemPhysicsSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UItemPhysicsSubsystem, STATGROUP_Tickables);
+}
+
+void UItemPhysicsSubsystem::TrackItem(AMasterItem* Item)
+{
+	if (!Item || Item->SettleIndex != INDEX_NONE)
+	{
+		return;
+	}
+
+	FSettleEntry& Entry = Tracked.AddDefaulted_GetRef();
+	Entry.Item = Item;
+	Item->SettleIndex = Tracked.Num() - 1;
+}
+
+void UItemPhysicsSubsystem::UntrackItem(AMasterItem* Item)
+{
+	if (Item && Tracked.IsValidIndex(Item->SettleIndex) && Tracked[Item->SettleIndex].Item.Get() == Item)
+	{
+		RemoveTrackedAt(Item->SettleIndex);
+	}
+	CancelRequest(Item);
+
+	if (Item && Item->bPhysicsResting)
+	{
+		Item->bPhysicsResting = false;
+		--NumRestingItems;
+	}
+}
+
+void UItemPhysicsSubsystem::RemoveTrackedAt(int32 Index)
+{
+	if (AMasterItem* Item = Tracked[Index].Item.Get())
+	{
+		Item->SettleIndex = INDEX_NONE;
+	}
+
+	Tracked.RemoveAtSwap(Index, 1, false);
+	if (Tracked.IsValidIndex(Index))
+	{
+		if (AMasterItem* MovedItem = Tracked[Index].Item.Get())
+		{
+			MovedItem->SettleIndex = Index;
+		}
+	}
+}
+
+void UItemPhysicsSubsystem::RequestSimulation(AMasterItem* Item, bool bSimulate)
+{
+	if (!Item)
+	{
+		return;
+	}
+
+	if (PendingToggles.IsValidIndex(Item->PendingPhysicsToggle) && PendingToggles[Item->PendingPhysicsToggle].Item.Get() == Item)
+	{
+		PendingToggles[Item->PendingPhysicsToggle].bSimulate = bSimulate;
+		return;
+	}
+
+	FPendingToggle& Toggle = PendingToggles.AddDefaulted_GetRef();
+	Toggle.Item = Item;
+	Toggle.bSimulate = bSimulate;
+	Item->PendingPhysicsToggle = PendingToggles.Num() - 1;
+}
+
+void UItemPhysicsSubsystem::CancelRequest(AMasterItem* Item)
+{
+	if (!Item || !PendingToggles.IsValidIndex(Item->PendingPhysicsToggle) || PendingToggles[Item->PendingPhysicsToggle].Item.Get() != Item)
+	{
+		return;
+	}
+
+	// Sem swap para manter a ordem de chegada; a entrada vazia é descartada no flush
+	PendingToggles[Item->PendingPhysicsToggle].Item.Reset();
+	Item->PendingPhysicsToggle = INDEX_NONE;
+}
+
+void UItemPhysicsSubsystem::Tick(float DeltaTime)
+{
+	UpdateSettleDetector(DeltaTime);
+	FlushPendingToggles();
+
+	SET_DWORD_STAT(STAT_ItemSettlingItems, Tracked.Num());
+	SET_DWORD_STAT(STAT_ItemRestingItems, NumRestingItems);
+}
+
+void UItemPhysicsSubsystem::UpdateSettleDetector(float DeltaTime)
+{
+	TimeSinceSettleCheck += DeltaTime;
+	if (TimeSinceSettleCheck < CVarItemSettleCheckInterval.GetValueOnGameThread() || Tracked.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_ItemSettleDetector);
+
+	const float ElapsedTime = TimeSinceSettleCheck;
+	TimeSinceSettleCheck = 0.0f;
+
+	const float LinearSpeedSquared = FMath::Square(CVarItemSettleLinearSpeed.GetValueOnGameThread());
+	const float AngularSpeedSquared = FMath::Square(CVarItemSettleAngularSpeed.GetValueOnGameThread());
+	const float SettleTime = CVarItemSettleTime.GetValueOnGameThread();
+	const bool bKinematicRest = IsKinematicRestEnabled();
+
+	// De trás para frente: a remoção com swap traz uma entrada já verificada
+	for (int32 Index = Tracked.Num() - 1; Index >= 0; --Index)
+	{
+		FSettleEntry& Entry = Tracked[Index];
+		AMasterItem* Item = Entry.Item.Get();
+		UPrimitiveComponent* Body = Item ? Cast<UPrimitiveComponent>(Item->GetRootComponent()) : nullptr;
+
+		// Item destruído, ou alguém já tirou o corpo da simulação (flutuando, instanciado)
+		if (!Body || !Body->IsSimulatingPhysics())
+		{
+			RemoveTrackedAt(Index);
+			continue;
+		}
+
+		const bool bBelowThreshold = !Body->RigidBodyIsAwake() ||
+			(Body->GetPhysicsLinearVelocity().SizeSquared() <= LinearSpeedSquared && Body->GetPhysicsAngularVelocityInDegrees().SizeSquared() <= AngularSpeedSquared);
+		Entry.RestTime = bBelowThreshold ? Entry.RestTime + ElapsedTime : 0.0f;
+		if (Entry.RestTime < SettleTime)
+		{
+			continue;
+		}
+
+		RemoveTrackedAt(Index);
+		if (bKinematicRest)
+		{
+			RequestSimulation(Item, false);
+		}
+		else
+		{
+			Item->CheckSettled();
+		}
+	}
+}
+
+void UItemPhysicsSubsystem::FlushPendingToggles()
+{
+	if (PendingToggles.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_ItemPhysicsToggleFlush);
+
+	const int32 NumToFlush = FMath::Min(PendingToggles.Num(), FMath::Max(1, CVarItemMaxPhysicsTogglesPerFrame.GetValueOnGameThread()));
+	for (int32 Index = 0; Index < NumToFlush; ++Index)
+	{
+		const FPendingToggle Toggle = PendingToggles[Index];
+		AMasterItem* Item = Toggle.Item.Get();
+		if (!Item)
+		{
+			continue;
+		}
+
+		Item->PendingPhysicsToggle = INDEX_NONE;
+		SetBodySimulating(Cast<UPrimitiveComponent>(Item->GetRootComponent()), Toggle.bSimulate);
+
+		if (Toggle.bSimulate)
+		{
+			if (Item->bPhysicsResting)
+			{
+				Item->bPhysicsResting = false;
+				--NumRestingItems;
+			}
+			TrackItem(Item);
+		}
+		else
+		{
+			if (!Item->bPhysicsResting)
+			{
+				Item->bPhysicsResting = true;
+				++NumRestingItems;
+			}
+			Item->CheckSettled();
+		}
+	}
+
+	// O que passou do limite do frame fica para o próximo, com os índices corrigidos
+	PendingToggles.RemoveAt(0, NumToFlush, false);
+	for (int32 Index = 0; Index < PendingToggles.Num(); ++Index)
+	{
+		if (AMasterItem* Item = PendingToggles[Index].Item.Get())
+		{
+			Item->PendingPhysicsToggle = Index;
+		}
+	}
+}
@@ -0,0 +1,71 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemPhysics
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ItemPhysicsSubsystem.generated.h"
+
+class AMasterItem;
+class UPrimitiveComponent;
+
+/**
+ * Detector de repouso e lote de trocas de simulação física dos itens
+ * Item cuja velocidade fica abaixo do limite por andromeda.Items.SettleTime vira kinematic e query-only
+ * Só volta a simular com um impulso externo (AMasterItem::ApplyExternalImpulse) ou ao terminar de flutuar
+ * Trocas de SetSimulatePhysics pedidas durante o frame são aplicadas juntas, uma por item, no Tick
+ */
+UCLASS()
+class ANDROMEDA_API UItemPhysicsSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Acompanha o item até o corpo assentar; ao assentar chama AMasterItem::CheckSettled
+	void TrackItem(AMasterItem* Item);
+	void UntrackItem(AMasterItem* Item);
+
+	// Enfileira a troca para o próximo Tick; pedidos repetidos no mesmo frame ficam só com o último
+	void RequestSimulation(AMasterItem* Item, bool bSimulate);
+	void CancelRequest(AMasterItem* Item);
+
+	// Aplica imediatamente: simulando (QueryAndPhysics) ou em repouso kinematic (QueryOnly)
+	static void SetBodySimulating(UPrimitiveComponent* Body, bool bSimulate);
+
+	// Se falso, itens assentados continuam simulando (apenas para comparação de custo)
+	static bool IsKinematicRestEnabled();
+
+	FORCEINLINE int32 GetNumTrackedItems() const { return Tracked.Num(); }
+	FORCEINLINE int32 GetNumRestingItems() const { return NumRestingItems; }
+
+private:
+	struct FSettleEntry
+	{
+		TWeakObjectPtr<AMasterItem> Item;
+		float RestTime = 0.0f; // Tempo contínuo abaixo dos limites de velocidade
+	};
+
+	struct FPendingToggle
+	{
+		TWeakObjectPtr<AMasterItem> Item;
+		bool bSimulate = false;
+	};
+
+	void UpdateSettleDetector(float DeltaTime);
+	void FlushPendingToggles();
+	void RemoveTrackedAt(int32 Index);
+
+	// Indexados por AMasterItem::SettleIndex e AMasterItem::PendingPhysicsToggle
+	TArray<FSettleEntry> Tracked;
+	TArray<FPendingToggle> PendingToggles;
+
+	float TimeSinceSettleCheck = 0.0f;
+	int32 NumRestingItems = 0;
+};
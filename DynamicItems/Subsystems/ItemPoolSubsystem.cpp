@@ -0,0 +1,262 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemPool
+
+#include "ItemPoolSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/MasterItem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/ItemStats.h"
+#include "AndromedaSystemsC/DynamicItems/Data/ItemDefinition.h"
+#include "AndromedaSystemsC/DynamicItems/Data/ItemPoolSettings.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemDefinitionRegistry.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemManagerSubsystem.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Pool Acquire"), STAT_ItemPoolAcquire, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pooled Items"), STAT_ItemPoolPooledItems, STATGROUP_AndromedaItems);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pool Hits"), STAT_ItemPoolHits, STATGROUP_AndromedaItems);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pool Misses"), STAT_ItemPoolMisses, STATGROUP_AndromedaItems);
+
+static FAutoConsoleCommandWithWorld GItemPoolStatsCommand(
+	TEXT("Andromeda.Items.PoolStats"),
+	TEXT("Mostra atores disponíveis por tipo e hits/misses do pool de itens"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		UItemPoolSubsystem* Pool = World ? World->GetSubsystem<UItemPoolSubsystem>() : nullptr;
+		if (!Pool)
+		{
+			return;
+		}
+
+		UItemDefinitionRegistry* Registry = UItemDefinitionRegistry::Get(World);
+		for (const FName& ID : UItemDefinitionRegistry::GetItemDefinitionIds())
+		{
+			if (const UItemDefinition* Definition = Registry ? Registry->FindDefinition(ID) : nullptr)
+			{
+				UE_LOG(LogTemp, Log, TEXT("UItemPoolSubsystem: %s -> %d disponíveis"), *ID.ToString(), Pool->GetNumPooled(Definition));
+			}
+		}
+		UE_LOG(LogTemp, Log, TEXT("UItemPoolSubsystem: %d hits, %d misses"), Pool->GetPoolHits(), Pool->GetPoolMisses());
+	}));
+
+// Mede a latência de um burst de spawn (ex: 200 itens no mesmo frame), com e sem pool aquecido
+static FAutoConsoleCommandWithWorldAndArgs GItemPoolBurstCommand(
+	TEXT("Andromeda.Items.PoolBurst"),
+	TEXT("Andromeda.Items.PoolBurst <Count> <ItemID> [Release=1] - Adquire Count itens em um frame e mede o tempo"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UItemPoolSubsystem* Pool = World ? World->GetSubsystem<UItemPoolSubsystem>() : nullptr;
+		UItemDefinitionRegistry* Registry = UItemDefinitionRegistry::Get(World);
+		if (!Pool || !Registry || Args.Num() < 2)
+		{
+			return;
+		}
+
+		const int32 Count = FMath::Max(1, FCString::Atoi(*Args[0]));
+		UItemDefinition* Definition = Registry->FindDefinition(FName(*Args[1]));
+		const bool bRelease = Args.Num() < 3 || FCString::Atoi(*Args[2]) != 0;
+		if (!Definition)
+		{
+			return;
+		}
+
+		const FVector Origin = UItemManagerSubsystem::GetFirstPlayerLocation(World, 300.0f);
+
+		const int32 HitsBefore = Pool->GetPoolHits();
+		TArray<AMasterItem*> Acquired;
+		Acquired.Reserve(Count);
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			const FVector Offset(FMath::FRandRange(-200.0f, 200.0f), FMath::FRandRange(-200.0f, 200.0f), 100.0f);
+			Acquired.Add(Pool->AcquireItem(Definition, 1, FTransform(Origin + Offset)));
+		}
+		const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		UE_LOG(LogTemp, Log, TEXT("UItemPoolSubsystem: burst de %d itens em %.3f ms (%d vindos do pool)"), Count, ElapsedMs, Pool->GetPoolHits() - HitsBefore);
+
+		if (bRelease)
+		{
+			for (AMasterItem* Item : Acquired)
+			{
+				Pool->ReleaseItem(Item);
+			}
+		}
+	}));
+
+// Cenário de rede: Count itens espalhados que caem, assentam e entram em dormência
+// Compare "stat net" e "stat AndromedaItems" no servidor com andromeda.Items.NetDormancy 1 e 0
+static FAutoConsoleCommandWithWorldAndArgs GItemNetBenchmarkCommand(
+	TEXT("Andromeda.Items.NetBenchmark"),
+	TEXT("Andromeda.Items.NetBenchmark <Count> <ItemID> - Spawna Count itens ociosos espalhados ao redor do player (ex: 5000)"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UItemPoolSubsystem* Pool = World ? World->GetSubsystem<UItemPoolSubsystem>() : nullptr;
+		UItemDefinitionRegistry* Registry = UItemDefinitionRegistry::Get(World);
+		if (!Pool || !Registry || Args.Num() < 2)
+		{
+			return;
+		}
+
+		const int32 Count = FMath::Max(1, FCString::Atoi(*Args[0]));
+		UItemDefinition* Definition = Registry->FindDefinition(FName(*Args[1]));
+		if (!Definition)
+		{
+			return;
+		}
+
+		const FVector Origin = UItemManagerSubsystem::GetFirstPlayerLocation(World);
+
+		// Grade espaçada para que os itens assentem sem se empilhar
+		const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Count)));
+		const float Spacing = 200.0f;
+		const FVector GridOrigin = Origin - FVector(GridSize * Spacing * 0.5f, GridSize * Spacing * 0.5f, -100.0f);
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			Pool->AcquireItem(Definition, 1, FTransform(GridOrigin + FVector((Index % GridSize) * Spacing, (Index / GridSize) * Spacing, 0.0f)));
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("UItemPoolSubsystem: %d itens '%s' spawnados para medição de rede"), Count, *Definition->ID.ToString());
+	}));
+
+bool UItemPoolSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Clientes recebem os itens pela replicação, o pool só existe com autoridade
+	const UWorld* World = Cast<UWorld>(Outer);
+	return Super::ShouldCreateSubsystem(Outer) && (!World || World->GetNetMode() != NM_Client);
+}
+
+void UItemPoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	UItemDefinitionRegistry* Registry = UItemDefinitionRegistry::Get(&InWorld);
+	if (!Registry)
+	{
+		return;
+	}
+
+	for (const TPair<FName, int32>& PrewarmCount : GetDefault<UItemPoolSettings>()->PrewarmCounts)
+	{
+		Prewarm(Registry->FindDefinition(PrewarmCount.Key), PrewarmCount.Value);
+	}
+}
+
+void UItemPoolSubsystem::Deinitialize()
+{
+	Pools.Reset();
+	NumPooledItems = 0;
+
+	Super::Deinitialize();
+}
+
+AMasterItem* UItemPoolSubsystem::AcquireItem(UItemDefinition* Definition, int32 Quantity, const FTransform& Transform)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ItemPoolAcquire);
+
+	if (!Definition)
+	{
+		return nullptr;
+	}
+
+	if (FItemActorPool* Pool = Pools.Find(Definition))
+	{
+		while (Pool->InactiveItems.Num() > 0)
+		{
+			AMasterItem* Item = Pool->InactiveItems.Pop(false);
+			--NumPooledItems;
+			if (IsValid(Item))
+			{
+				++PoolHits;
+				INC_DWORD_STAT(STAT_ItemPoolHits);
+				SET_DWORD_STAT(STAT_ItemPoolPooledItems, NumPooledItems);
+
+				Item->ActivateFromPool(Definition, Quantity, Transform);
+				return Item;
+			}
+		}
+	}
+
+	++PoolMisses;
+	INC_DWORD_STAT(STAT_ItemPoolMisses);
+
+	return SpawnItem(Definition, Quantity, Transform);
+}
+
+void UItemPoolSubsystem::ReleaseItem(AMasterItem* Item)
+{
+	if (!IsValid(Item) || Item->IsActorBeingDestroyed() || Item->IsInPool())
+	{
+		return;
+	}
+
+	// Atores do nível (carregados ou startup de rede) não entram no pool: os clientes têm a própria cópia
+	// e o ator continuaria visível neles; destruir faz o servidor replicar a remoção
+	if (Item->HasAnyFlags(RF_WasLoaded) || Item->IsNetStartupActor())
+	{
+		Item->Destroy();
+		return;
+	}
+
+	UItemDefinition* Definition = Item->GetDefinition();
+	if (!Definition)
+	{
+		Item->Destroy();
+		return;
+	}
+
+	FItemActorPool& Pool = Pools.FindOrAdd(Definition);
+	if (Pool.InactiveItems.Num() >= GetDefault<UItemPoolSettings>()->MaxPooledPerType)
+	{
+		Item->Destroy();
+		return;
+	}
+
+	Item->DeactivateForPool();
+	Pool.InactiveItems.Add(Item);
+	++NumPooledItems;
+	SET_DWORD_STAT(STAT_ItemPoolPooledItems, NumPooledItems);
+}
+
+void UItemPoolSubsystem::Prewarm(UItemDefinition* Definition, int32 Count)
+{
+	if (!Definition || Count <= 0)
+	{
+		return;
+	}
+
+	// Spawnar longe de tudo; o ator passa pelo BeginPlay completo uma única vez e já volta para o pool
+	const FTransform HiddenTransform(FVector(0.0f, 0.0f, -100000.0f));
+	const int32 NumToCreate = Count - GetNumPooled(Definition);
+	for (int32 Index = 0; Index < NumToCreate; ++Index)
+	{
+		if (AMasterItem* Item = SpawnItem(Definition, 1, HiddenTransform))
+		{
+			ReleaseItem(Item);
+		}
+	}
+}
+
+int32 UItemPoolSubsystem::GetNumPooled(const UItemDefinition* Definition) const
+{
+	const FItemActorPool* Pool = Pools.Find(Definition);
+	return Pool ? Pool->InactiveItems.Num() : 0;
+}
+
+AMasterItem* UItemPoolSubsystem::SpawnItem(UItemDefinition* Definition, int32 Quantity, const FTransform& Transform)
+{
+	UWorld* World = GetWorld();
+	UClass* ItemClass = GetDefault<UItemPoolSettings>()->ItemActorClass.LoadSynchronous();
+	if (!World || !ItemClass)
+	{
+		ItemClass = AMasterItem::StaticClass();
+	}
+
+	AMasterItem* Item = World ? World->SpawnActorDeferred<AMasterItem>(ItemClass, Transform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn) : nullptr;
+	if (Item)
+	{
+		Item->InitializeItem(Definition, Quantity);
+		Item->FinishSpawning(Transform);
+	}
+
+	return Item;
+}
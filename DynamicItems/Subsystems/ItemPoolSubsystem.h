@@ -0,0 +1,63 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemPool
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ItemPoolSubsystem.generated.h"
+
+class AMasterItem;
+class UItemDefinition;
+
+USTRUCT()
+struct FItemActorPool
+{
+	GENERATED_BODY()
+
+	// Atores desativados (escondidos, sem física e com componentes desregistrados)
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AMasterItem>> InactiveItems;
+};
+
+/**
+ * Pool de atores AMasterItem por tipo de item
+ * Evita o custo de construtor + BeginPlay (SetupMesh/SetupLight/SetupWidgets) em drops e pickups
+ * Só atua com autoridade: em clientes os atores continuam vindo da replicação
+ */
+UCLASS()
+class ANDROMEDA_API UItemPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// Retorna um item ativo na posição indicada, reaproveitando um ator do pool quando houver
+	UFUNCTION(BlueprintCallable, Category = "Item|Pool")
+	AMasterItem* AcquireItem(UItemDefinition* Definition, int32 Quantity, const FTransform& Transform);
+
+	// Desativa o item e o devolve ao pool (ou destrói se o pool do tipo estiver cheio ou o ator for do nível)
+	UFUNCTION(BlueprintCallable, Category = "Item|Pool")
+	void ReleaseItem(AMasterItem* Item);
+
+	// Pré-cria Count atores desativados para a definição
+	UFUNCTION(BlueprintCallable, Category = "Item|Pool")
+	void Prewarm(UItemDefinition* Definition, int32 Count);
+
+	int32 GetNumPooled(const UItemDefinition* Definition) const;
+	FORCEINLINE int32 GetPoolHits() const { return PoolHits; }
+	FORCEINLINE int32 GetPoolMisses() const { return PoolMisses; }
+
+private:
+	AMasterItem* SpawnItem(UItemDefinition* Definition, int32 Quantity, const FTransform& Transform);
+
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UItemDefinition>, FItemActorPool> Pools;
+
+	int32 NumPooledItems = 0;
+	int32 PoolHits = 0;
+	int32 PoolMisses = 0;
+};
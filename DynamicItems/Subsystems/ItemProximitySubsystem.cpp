@@ -0,0 +1,290 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemProximity
+
+#include "ItemProximitySubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/MasterItem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/ItemStats.h"
+#include "DrawDebugHelpers.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "HAL/IConsoleManager.h"
+#include "Algo/BinarySearch.h"
+
+DECLARE_CYCLE_STAT(TEXT("Proximity Tick"), STAT_ItemProximityTick, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Proximity Items"), STAT_ItemProximityItems, STATGROUP_AndromedaItems);
+
+// Custo da consulta por frame em função do número de itens e de players, comparado com a varredura linear
+static FAutoConsoleCommandWithArgs GItemProximityBenchmarkCommand(
+	TEXT("Andromeda.Items.ProximityBenchmark"),
+	TEXT("Andromeda.Items.ProximityBenchmark <Items> <Players> [Iterations] - Mede o custo da consulta de proximidade por frame"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 NumItems = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10000;
+		const int32 NumPlayers = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 16;
+		const int32 Iterations = Args.Num() > 2 ? FMath::Max(1, FCString::Atoi(*Args[2])) : 100;
+
+		// Itens espalhados em 2 km x 2 km, raio mínimo de interação padrão
+		const float WorldExtent = 100000.0f;
+		const float ItemRadius = 200.0f;
+		FRandomStream Random(1234);
+
+		FItemSpatialHash SpatialHash;
+		TArray<FVector> ItemLocations;
+		ItemLocations.Reserve(NumItems);
+		for (int32 Index = 0; Index < NumItems; ++Index)
+		{
+			const FVector Location(Random.FRandRange(-WorldExtent, WorldExtent), Random.FRandRange(-WorldExtent, WorldExtent), 0.0f);
+			ItemLocations.Add(Location);
+			SpatialHash.Add(Location, ItemRadius);
+		}
+
+		TArray<FVector> PlayerLocations;
+		for (int32 Index = 0; Index < NumPlayers; ++Index)
+		{
+			PlayerLocations.Emplace(Random.FRandRange(-WorldExtent, WorldExtent), Random.FRandRange(-WorldExtent, WorldExtent), 0.0f);
+		}
+
+		int32 Found = 0;
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			for (const FVector& PlayerLocation : PlayerLocations)
+			{
+				SpatialHash.ForEachCovering(PlayerLocation, [&Found](int32) { ++Found; });
+			}
+		}
+		const double HashMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / Iterations;
+
+		int32 FoundLinear = 0;
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			for (const FVector& PlayerLocation : PlayerLocations)
+			{
+				for (const FVector& ItemLocation : ItemLocations)
+				{
+					FoundLinear += FVector::DistSquared(ItemLocation, PlayerLocation) <= FMath::Square(ItemRadius) ? 1 : 0;
+				}
+			}
+		}
+		const double LinearMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / Iterations;
+
+		UE_LOG(LogTemp, Log, TEXT("UItemProximitySubsystem: %d itens x %d players -> spatial hash %.4f ms/frame, varredura linear %.4f ms/frame (%d/%d encontrados)"),
+			NumItems, NumPlayers, HashMs, LinearMs, Found / Iterations, FoundLinear / Iterations);
+	}));
+
+void UItemProximitySubsystem::Deinitialize()
+{
+	SpatialHash.Reset();
+	ItemsByHandle.Reset();
+	DebugDrawHandles.Reset();
+	Players.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UItemProximitySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UItemProximitySubsystem, STATGROUP_Tickables);
+}
+
+int32 UItemProximitySubsystem::RegisterItem(AMasterItem* Item, float Radius)
+{
+	if (!Item)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Handle = SpatialHash.Add(Item->GetActorLocation(), Radius);
+	if (ItemsByHandle.Num() <= Handle)
+	{
+		ItemsByHandle.SetNum(Handle + 1);
+	}
+	ItemsByHandle[Handle] = Item;
+
+	SET_DWORD_STAT(STAT_ItemProximityItems, SpatialHash.Num());
+	return Handle;
+}
+
+void UItemProximitySubsystem::UnregisterItem(int32 Handle)
+{
+	if (!SpatialHash.IsValidHandle(Handle))
+	{
+		return;
+	}
+
+	// Sem eventos de saída: o item está indo embora (pool, destruição)
+	for (FPlayerProximity& Proximity : Players)
+	{
+		const int32 Slot = Algo::BinarySearch(Proximity.ItemsInRange, Handle);
+		if (Slot != INDEX_NONE)
+		{
+			Proximity.ItemsInRange.RemoveAt(Slot, 1, false);
+		}
+	}
+
+	DebugDrawHandles.Remove(Handle);
+	ItemsByHandle[Handle].Reset();
+	SpatialHash.Remove(Handle);
+
+	SET_DWORD_STAT(STAT_ItemProximityItems, SpatialHash.Num());
+}
+
+void UItemProximitySubsystem::UpdateItemLocation(int32 Handle, const FVector& Location)
+{
+	SpatialHash.Move(Handle, Location);
+}
+
+void UItemProximitySubsystem::UpdateItemRadius(int32 Handle, float Radius)
+{
+	SpatialHash.SetRadius(Handle, Radius);
+}
+
+void UItemProximitySubsystem::SetItemDebugDraw(int32 Handle, bool bDebugDraw)
+{
+	if (bDebugDraw && SpatialHash.IsValidHandle(Handle))
+	{
+		DebugDrawHandles.Add(Handle);
+	}
+	else
+	{
+		DebugDrawHandles.Remove(Handle);
+	}
+}
+
+void UItemProximitySubsystem::GetCharactersInRange(int32 Handle, TArray<ACharacter*>& OutCharacters) const
+{
+	for (const FPlayerProximity& Proximity : Players)
+	{
+		ACharacter* Character = Proximity.Character.Get();
+		if (Character && Algo::BinarySearch(Proximity.ItemsInRange, Handle) != INDEX_NONE)
+		{
+			OutCharacters.Add(Character);
+		}
+	}
+}
+
+void UItemProximitySubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ItemProximityTick);
+
+	TArray<ACharacter*> Characters;
+	GatherPlayerCharacters(Characters);
+
+	// Eventos são coletados e disparados depois, pois o item pode sair do registro ao recebê-los
+	TArray<TPair<int32, ACharacter*>> EndEvents;
+	TArray<TPair<int32, ACharacter*>> BeginEvents;
+
+	// Pawns que deixaram de ser de players saem de todos os itens
+	for (int32 PlayerIndex = Players.Num() - 1; PlayerIndex >= 0; --PlayerIndex)
+	{
+		ACharacter* Character = Players[PlayerIndex].Character.Get();
+		if (!Character || !Characters.Contains(Character))
+		{
+			if (Character)
+			{
+				for (int32 Handle : Players[PlayerIndex].ItemsInRange)
+				{
+					EndEvents.Emplace(Handle, Character);
+				}
+			}
+			Players.RemoveAtSwap(PlayerIndex, 1, false);
+		}
+	}
+
+	TArray<int32> NewItemsInRange;
+	for (ACharacter* Character : Characters)
+	{
+		FPlayerProximity* Proximity = Players.FindByPredicate([Character](const FPlayerProximity& Entry) { return Entry.Character.Get() == Character; });
+		if (!Proximity)
+		{
+			Proximity = &Players.AddDefaulted_GetRef();
+			Proximity->Character = Character;
+		}
+
+		NewItemsInRange.Reset();
+		SpatialHash.ForEachCovering(Character->GetActorLocation(), [&NewItemsInRange](int32 Handle) { NewItemsInRange.Add(Handle); });
+		NewItemsInRange.Sort();
+
+		// Diff entre as listas ordenadas do frame anterior e do atual
+		const TArray<int32>& OldItemsInRange = Proximity->ItemsInRange;
+		int32 OldIndex = 0;
+		int32 NewIndex = 0;
+		while (OldIndex < OldItemsInRange.Num() || NewIndex < NewItemsInRange.Num())
+		{
+			if (NewIndex >= NewItemsInRange.Num() || (OldIndex < OldItemsInRange.Num() && OldItemsInRange[OldIndex] < NewItemsInRange[NewIndex]))
+			{
+				EndEvents.Emplace(OldItemsInRange[OldIndex++], Character);
+			}
+			else if (OldIndex >= OldItemsInRange.Num() || NewItemsInRange[NewIndex] < OldItemsInRange[OldIndex])
+			{
+				BeginEvents.Emplace(NewItemsInRange[NewIndex++], Character);
+			}
+			else
+			{
+				++OldIndex;
+				++NewIndex;
+			}
+		}
+
+		Swap(Proximity->ItemsInRange, NewItemsInRange);
+	}
+
+	// Saídas antes das entradas: o item aceita um player por vez
+	for (const TPair<int32, ACharacter*>& EndEvent : EndEvents)
+	{
+		if (AMasterItem* Item = ItemsByHandle.IsValidIndex(EndEvent.Key) ? ItemsByHandle[EndEvent.Key].Get() : nullptr)
+		{
+			Item->OnProximityEnd(EndEvent.Value);
+		}
+	}
+	for (const TPair<int32, ACharacter*>& BeginEvent : BeginEvents)
+	{
+		if (AMasterItem* Item = ItemsByHandle.IsValidIndex(BeginEvent.Key) ? ItemsByHandle[BeginEvent.Key].Get() : nullptr)
+		{
+			Item->OnProximityBegin(BeginEvent.Value);
+		}
+	}
+
+#if ENABLE_DRAW_DEBUG
+	for (int32 Handle : DebugDrawHandles)
+	{
+		if (SpatialHash.IsValidHandle(Handle))
+		{
+			DrawDebugSphere(GetWorld(), SpatialHash.GetLocation(Handle), SpatialHash.GetRadius(Handle), 16, FColor::Green);
+		}
+	}
+#endif
+}
+
+void UItemProximitySubsystem::GatherPlayerCharacters(TArray<ACharacter*>& OutCharacters) const
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// PlayerArray existe no servidor e nos clientes; os pawns de outros players podem não ser relevantes
+	if (const AGameStateBase* GameState = World->GetGameState())
+	{
+		for (const APlayerState* PlayerState : GameState->PlayerArray)
+		{
+			if (ACharacter* Character = PlayerState ? Cast<ACharacter>(PlayerState->GetPawn()) : nullptr)
+			{
+				OutCharacters.AddUnique(Character);
+			}
+		}
+		return;
+	}
+
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (ACharacter* Character = It->IsValid() ? Cast<ACharacter>((*It)->GetPawn()) : nullptr)
+		{
+			OutCharacters.AddUnique(Character);
+		}
+	}
+}
@@ -0,0 +1,56 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemProximity
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/ItemSpatialHash.h"
+#include "ItemProximitySubsystem.generated.h"
+
+class AMasterItem;
+class ACharacter;
+
+/**
+ * Detecção de proximidade player/item sem componentes de overlap de física
+ * As posições dos itens ficam em um FItemSpatialHash consultado uma vez por frame por pawn de player
+ * Gera os mesmos eventos de entrada/saída que a antiga CollisionSphere
+ */
+UCLASS()
+class ANDROMEDA_API UItemProximitySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Registro de itens; retorna o handle usado nas demais chamadas
+	int32 RegisterItem(AMasterItem* Item, float Radius);
+	void UnregisterItem(int32 Handle);
+	void UpdateItemLocation(int32 Handle, const FVector& Location);
+	void UpdateItemRadius(int32 Handle, float Radius);
+	void SetItemDebugDraw(int32 Handle, bool bDebugDraw);
+
+	// Players que estavam no alcance do item na última consulta
+	void GetCharactersInRange(int32 Handle, TArray<ACharacter*>& OutCharacters) const;
+
+	FORCEINLINE int32 GetNumItems() const { return SpatialHash.Num(); }
+
+private:
+	struct FPlayerProximity
+	{
+		TWeakObjectPtr<ACharacter> Character;
+		TArray<int32> ItemsInRange; // Ordenado, para o diff entre frames
+	};
+
+	void GatherPlayerCharacters(TArray<ACharacter*>& OutCharacters) const;
+
+	FItemSpatialHash SpatialHash;
+	TArray<TWeakObjectPtr<AMasterItem>> ItemsByHandle;
+	TSet<int32> DebugDrawHandles;
+	TArray<FPlayerProximity> Players;
+};
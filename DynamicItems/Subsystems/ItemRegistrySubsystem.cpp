@@ -0,0 +1,316 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemRegistry
+
+#include "ItemRegistrySubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/MasterItem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/ItemStats.h"
+#include "AndromedaSystemsC/DynamicItems/Data/ItemDefinition.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemManagerSubsystem.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Registry Query"), STAT_ItemRegistryQuery, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Registry Items"), STAT_ItemRegistryItems, STATGROUP_AndromedaItems);
+
+// Compara as consultas do registro com varreduras TActorIterator sobre os itens atuais do mundo
+static FAutoConsoleCommandWithWorldAndArgs GItemRegistryBenchmarkCommand(
+	TEXT("Andromeda.Items.RegistryBenchmark"),
+	TEXT("Andromeda.Items.RegistryBenchmark [Iterations] [Radius] - Mede consultas por ID, raio e mais próximo contra TActorIterator"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UItemRegistrySubsystem* ItemRegistry = World ? World->GetSubsystem<UItemRegistrySubsystem>() : nullptr;
+		if (!ItemRegistry)
+		{
+			return;
+		}
+
+		const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100;
+		const float Radius = Args.Num() > 1 ? FMath::Max(1.0f, FCString::Atof(*Args[1])) : 2000.0f;
+
+		const FVector Center = UItemManagerSubsystem::GetFirstPlayerLocation(World);
+
+		// ID de referência: o do primeiro item encontrado
+		FName ID = NAME_None;
+		for (TActorIterator<AMasterItem> It(World); It; ++It)
+		{
+			ID = It->GetItemID();
+			break;
+		}
+
+		FItemRegistryFilter RangeFilter;
+		RangeFilter.bFilterState = true;
+		RangeFilter.State = EItemState::Broken;
+
+		FItemRegistryFilter NearestFilter;
+		NearestFilter.bFilterRarity = true;
+		NearestFilter.Rarity = EItemRarity::Quantum;
+
+		TArray<AMasterItem*> Results;
+		auto Measure = [Iterations](TFunctionRef<void()> Query)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				Query();
+			}
+			return (FPlatformTime::Seconds() - StartTime) * 1000.0 / Iterations;
+		};
+
+		const double RegistryByIDMs = Measure([&]() { Results.Reset(); ItemRegistry->FindItemsByID(ID, Results); });
+		const double ScanByIDMs = Measure([&]()
+		{
+			Results.Reset();
+			for (TActorIterator<AMasterItem> It(World); It; ++It)
+			{
+				if (It->GetItemID() == ID)
+				{
+					Results.Add(*It);
+				}
+			}
+		});
+
+		const double RegistryRangeMs = Measure([&]() { Results.Reset(); ItemRegistry->FindItemsInRange(Center, Radius, RangeFilter, Results); });
+		const double ScanRangeMs = Measure([&]()
+		{
+			Results.Reset();
+			for (TActorIterator<AMasterItem> It(World); It; ++It)
+			{
+				const UItemDefinition* Definition = It->GetDefinition();
+				if (Definition && Definition->STInfos.State == EItemState::Broken && FVector::DistSquared(It->GetActorLocation(), Center) <= FMath::Square(Radius))
+				{
+					Results.Add(*It);
+				}
+			}
+		});
+
+		const double RegistryNearestMs = Measure([&]() { ItemRegistry->FindNearestItem(Center, NearestFilter); });
+		const double ScanNearestMs = Measure([&]()
+		{
+			AMasterItem* Nearest = nullptr;
+			float NearestDistSquared = TNumericLimits<float>::Max();
+			for (TActorIterator<AMasterItem> It(World); It; ++It)
+			{
+				const UItemDefinition* Definition = It->GetDefinition();
+				const float DistSquared = FVector::DistSquared(It->GetActorLocation(), Center);
+				if (Definition && Definition->STInfos.Rarity == EItemRarity::Quantum && DistSquared < NearestDistSquared)
+				{
+					Nearest = *It;
+					NearestDistSquared = DistSquared;
+				}
+			}
+		});
+
+		UE_LOG(LogTemp, Log, TEXT("UItemRegistrySubsystem: %d itens registrados, %d iterações"), ItemRegistry->GetNumItems(), Iterations);
+		UE_LOG(LogTemp, Log, TEXT("  por ID '%s':          registro %.4f ms, TActorIterator %.4f ms"), *ID.ToString(), RegistryByIDMs, ScanByIDMs);
+		UE_LOG(LogTemp, Log, TEXT("  Broken em %.0f:       registro %.4f ms, TActorIterator %.4f ms"), Radius, RegistryRangeMs, ScanRangeMs);
+		UE_LOG(LogTemp, Log, TEXT("  Quantum mais próximo: registro %.4f ms, TActorIterator %.4f ms"), RegistryNearestMs, ScanNearestMs);
+	}));
+
+void UItemRegistrySubsystem::Deinitialize()
+{
+	SpatialHash.Reset();
+	Entries.Reset();
+	HandlesByID.Reset();
+	RegisteredBits.Reset();
+	RarityBits.Reset();
+	StateBits.Reset();
+
+	Super::Deinitialize();
+}
+
+void UItemRegistrySubsystem::SetBit(TBitArray<>& Bits, int32 Handle, bool bValue)
+{
+	if (Bits.Num() <= Handle)
+	{
+		if (!bValue)
+		{
+			return;
+		}
+		Bits.SetNum(Handle + 1, false);
+	}
+	Bits[Handle] = bValue;
+}
+
+int32 UItemRegistrySubsystem::RegisterItem(AMasterItem* Item)
+{
+	const UItemDefinition* Definition = Item ? Item->GetDefinition() : nullptr;
+	if (!Definition)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Handle = SpatialHash.Add(Item->GetActorLocation(), 0.0f);
+	if (Entries.Num() <= Handle)
+	{
+		Entries.SetNum(Handle + 1);
+	}
+
+	FRegistryEntry& Entry = Entries[Handle];
+	Entry.Item = Item;
+	Entry.ID = Definition->ID;
+	Entry.Rarity = Definition->STInfos.Rarity;
+	Entry.State = Definition->STInfos.State;
+
+	HandlesByID.FindOrAdd(Entry.ID).Add(Handle);
+
+	if (RarityBits.Num() <= static_cast<int32>(Entry.Rarity))
+	{
+		RarityBits.SetNum(static_cast<int32>(Entry.Rarity) + 1);
+	}
+	if (StateBits.Num() <= static_cast<int32>(Entry.State))
+	{
+		StateBits.SetNum(static_cast<int32>(Entry.State) + 1);
+	}
+	SetBit(RegisteredBits, Handle, true);
+	SetBit(RarityBits[static_cast<int32>(Entry.Rarity)], Handle, true);
+	SetBit(StateBits[static_cast<int32>(Entry.State)], Handle, true);
+
+	SET_DWORD_STAT(STAT_ItemRegistryItems, SpatialHash.Num());
+	return Handle;
+}
+
+void UItemRegistrySubsystem::UnregisterItem(int32 Handle)
+{
+	if (!SpatialHash.IsValidHandle(Handle))
+	{
+		return;
+	}
+
+	FRegistryEntry& Entry = Entries[Handle];
+	if (TArray<int32>* Handles = HandlesByID.Find(Entry.ID))
+	{
+		Handles->RemoveSingleSwap(Handle, false);
+		if (Handles->Num() == 0)
+		{
+			HandlesByID.Remove(Entry.ID);
+		}
+	}
+
+	SetBit(RegisteredBits, Handle, false);
+	SetBit(RarityBits[static_cast<int32>(Entry.Rarity)], Handle, false);
+	SetBit(StateBits[static_cast<int32>(Entry.State)], Handle, false);
+
+	Entry = FRegistryEntry();
+	SpatialHash.Remove(Handle);
+
+	SET_DWORD_STAT(STAT_ItemRegistryItems, SpatialHash.Num());
+}
+
+void UItemRegistrySubsystem::UpdateItemLocation(int32 Handle, const FVector& Location)
+{
+	SpatialHash.Move(Handle, Location);
+}
+
+bool UItemRegistrySubsystem::MatchesFilter(int32 Handle, const FItemRegistryFilter& Filter) const
+{
+	const FRegistryEntry& Entry = Entries[Handle];
+	return (Filter.ID.IsNone() || Entry.ID == Filter.ID)
+		&& (!Filter.bFilterRarity || Entry.Rarity == Filter.Rarity)
+		&& (!Filter.bFilterState || Entry.State == Filter.State);
+}
+
+void UItemRegistrySubsystem::FindItemsByID(FName ID, TArray<AMasterItem*>& OutItems) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_ItemRegistryQuery);
+
+	if (const TArray<int32>* Handles = HandlesByID.Find(ID))
+	{
+		OutItems.Reserve(OutItems.Num() + Handles->Num());
+		for (int32 Handle : *Handles)
+		{
+			if (AMasterItem* Item = Entries[Handle].Item.Get())
+			{
+				OutItems.Add(Item);
+			}
+		}
+	}
+}
+
+void UItemRegistrySubsystem::FindItemsInRange(const FVector& Center, float Radius, const FItemRegistryFilter& Filter, TArray<AMasterItem*>& OutItems) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_ItemRegistryQuery);
+
+	SpatialHash.ForEachInRadius(Center, Radius, [this, &Filter, &OutItems](int32 Handle)
+	{
+		if (MatchesFilter(Handle, Filter))
+		{
+			if (AMasterItem* Item = Entries[Handle].Item.Get())
+			{
+				OutItems.Add(Item);
+			}
+		}
+	});
+}
+
+AMasterItem* UItemRegistrySubsystem::FindNearestItem(const FVector& Center, const FItemRegistryFilter& Filter, float MaxDistance) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_ItemRegistryQuery);
+
+	int32 NearestHandle = INDEX_NONE;
+	float NearestDistSquared = MaxDistance > 0.0f ? FMath::Square(MaxDistance) : TNumericLimits<float>::Max();
+	auto ConsiderHandle = [this, &Center, &NearestHandle, &NearestDistSquared](int32 Handle)
+	{
+		const float DistSquared = FVector::DistSquared(SpatialHash.GetLocation(Handle), Center);
+		if (DistSquared <= NearestDistSquared && Entries[Handle].Item.IsValid())
+		{
+			NearestHandle = Handle;
+			NearestDistSquared = DistSquared;
+		}
+	};
+
+	if (MaxDistance > 0.0f)
+	{
+		// Com limite de distância: apenas as células do raio
+		SpatialHash.ForEachInRadius(Center, MaxDistance, [this, &Filter, &ConsiderHandle](int32 Handle)
+		{
+			if (MatchesFilter(Handle, Filter))
+			{
+				ConsiderHandle(Handle);
+			}
+		});
+	}
+	else if (!Filter.ID.IsNone())
+	{
+		// Sem limite: percorrer só as instâncias do ID
+		if (const TArray<int32>* Handles = HandlesByID.Find(Filter.ID))
+		{
+			for (int32 Handle : *Handles)
+			{
+				if (MatchesFilter(Handle, Filter))
+				{
+					ConsiderHandle(Handle);
+				}
+			}
+		}
+	}
+	else
+	{
+		// Sem limite: interseção dos bitsets, percorrendo só os itens que passam no filtro
+		TBitArray<> Mask = RegisteredBits;
+		if (Filter.bFilterRarity)
+		{
+			const int32 RarityIndex = static_cast<int32>(Filter.Rarity);
+			if (!RarityBits.IsValidIndex(RarityIndex))
+			{
+				return nullptr;
+			}
+			Mask.CombineWithBitwiseAND(RarityBits[RarityIndex], EBitwiseOperatorFlags::MinSize);
+		}
+		if (Filter.bFilterState)
+		{
+			const int32 StateIndex = static_cast<int32>(Filter.State);
+			if (!StateBits.IsValidIndex(StateIndex))
+			{
+				return nullptr;
+			}
+			Mask.CombineWithBitwiseAND(StateBits[StateIndex], EBitwiseOperatorFlags::MinSize);
+		}
+
+		for (TConstSetBitIterator<> It(Mask); It; ++It)
+		{
+			ConsiderHandle(It.GetIndex());
+		}
+	}
+
+	return NearestHandle != INDEX_NONE ? Entries[NearestHandle].Item.Get() : nullptr;
+}
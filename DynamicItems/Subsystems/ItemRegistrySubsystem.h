@@ -0,0 +1,91 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemRegistry
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/ItemSpatialHash.h"
+#include "AndromedaSystemsC/DynamicItems/Structure/ItemEnums.h"
+#include "ItemRegistrySubsystem.generated.h"
+
+class AMasterItem;
+
+/**
+ * Filtro das consultas do UItemRegistrySubsystem (campos desligados aceitam qualquer valor)
+ */
+USTRUCT(BlueprintType)
+struct FItemRegistryFilter
+{
+	GENERATED_BODY()
+
+	// None = qualquer ID
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item")
+	FName ID;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item", meta = (InlineEditConditionToggle))
+	bool bFilterRarity = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item", meta = (EditCondition = "bFilterRarity"))
+	EItemRarity Rarity = EItemRarity::None;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item", meta = (InlineEditConditionToggle))
+	bool bFilterState = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item", meta = (EditCondition = "bFilterState"))
+	EItemState State = EItemState::None;
+};
+
+/**
+ * Índice dos itens ativos no mundo para consultas de gameplay (quests, IA)
+ * Hash por ID, bitsets por raridade/estado e spatial hash: nenhuma consulta percorre todos os atores
+ */
+UCLASS()
+class ANDROMEDA_API UItemRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem
+	virtual void Deinitialize() override;
+
+	// Registro de itens (ativação e desativação do item); retorna o handle usado nas demais chamadas
+	int32 RegisterItem(AMasterItem* Item);
+	void UnregisterItem(int32 Handle);
+	void UpdateItemLocation(int32 Handle, const FVector& Location);
+
+	// Todas as instâncias de um ID
+	UFUNCTION(BlueprintCallable, Category = "Item|Registry")
+	void FindItemsByID(FName ID, TArray<AMasterItem*>& OutItems) const;
+
+	// Itens dentro de Radius que passam no filtro
+	UFUNCTION(BlueprintCallable, Category = "Item|Registry")
+	void FindItemsInRange(const FVector& Center, float Radius, const FItemRegistryFilter& Filter, TArray<AMasterItem*>& OutItems) const;
+
+	// Item mais próximo que passa no filtro (MaxDistance <= 0: sem limite)
+	UFUNCTION(BlueprintCallable, Category = "Item|Registry")
+	AMasterItem* FindNearestItem(const FVector& Center, const FItemRegistryFilter& Filter, float MaxDistance = 0.0f) const;
+
+	FORCEINLINE int32 GetNumItems() const { return SpatialHash.Num(); }
+
+private:
+	struct FRegistryEntry
+	{
+		TWeakObjectPtr<AMasterItem> Item;
+		FName ID;
+		EItemRarity Rarity = EItemRarity::None;
+		EItemState State = EItemState::None;
+	};
+
+	bool MatchesFilter(int32 Handle, const FItemRegistryFilter& Filter) const;
+	void SetBit(TBitArray<>& Bits, int32 Handle, bool bValue);
+
+	// Entradas indexadas pelo handle do spatial hash (índices estáveis)
+	FItemSpatialHash SpatialHash{1000.0f};
+	TArray<FRegistryEntry> Entries;
+	TMap<FName, TArray<int32>> HandlesByID;
+
+	// Um bitset por valor do enum, com um bit por handle
+	TBitArray<> RegisteredBits;
+	TArray<TBitArray<>> RarityBits;
+	TArray<TBitArray<>> StateBits;
+};
@@ -0,0 +1,215 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemStackMerge
+
+#include "ItemStackMergeSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/MasterItem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/ItemStats.h"
+#include "AndromedaSystemsC/DynamicItems/Data/ItemDefinition.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemBatchSpawnSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemDefinitionRegistry.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemManagerSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemPoolSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemRegistrySubsystem.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Stack Merge Pass"), STAT_ItemStackMergePass, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Stack Merge Candidates"), STAT_ItemStackMergeCandidates, STATGROUP_AndromedaItems);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Stack Merged Actors"), STAT_ItemStackMergedActors, STATGROUP_AndromedaItems);
+
+static TAutoConsoleVariable<bool> CVarItemStackMerge(
+	TEXT("andromeda.Items.StackMerge"),
+	true,
+	TEXT("Se verdadeiro, itens empilháveis iguais que assentam próximos são unidos em um único ator (servidor)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarItemStackMergeRadius(
+	TEXT("andromeda.Items.StackMergeRadius"),
+	150.0f,
+	TEXT("Distância máxima entre dois itens para serem unidos."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarItemStackMergeInterval(
+	TEXT("andromeda.Items.StackMergeInterval"),
+	0.5f,
+	TEXT("Intervalo em segundos entre passes de merge."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarItemStackMergeMaxPerPass(
+	TEXT("andromeda.Items.StackMergeMaxPerPass"),
+	64,
+	TEXT("Máximo de candidatos processados por pass; o restante fica para os próximos."),
+	ECVF_Default);
+
+// Simula um drop em massa: Count itens iguais caindo amontoados na frente do player
+// Compare "stat AndromedaItems" (Registered Items, Stack Merged Actors) com andromeda.Items.StackMerge 1 e 0
+static FAutoConsoleCommandWithWorldAndArgs GItemMassDropCommand(
+	TEXT("Andromeda.Items.MassDrop"),
+	TEXT("Andromeda.Items.MassDrop <Count> <ItemID> [Spread=150] [Batched=0] - Spawna Count itens de quantidade 1 amontoados"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UItemBatchSpawnSubsystem* BatchSpawn = World ? World->GetSubsystem<UItemBatchSpawnSubsystem>() : nullptr;
+		UItemDefinitionRegistry* Registry = UItemDefinitionRegistry::Get(World);
+		if (!BatchSpawn || !Registry || Args.Num() < 2)
+		{
+			return;
+		}
+
+		const int32 Count = FMath::Max(1, FCString::Atoi(*Args[0]));
+		UItemDefinition* Definition = Registry->FindDefinition(FName(*Args[1]));
+		const float Spread = Args.Num() > 2 ? FCString::Atof(*Args[2]) : 150.0f;
+		const bool bBatched = Args.Num() > 3 && FCString::Atoi(*Args[3]) != 0;
+		if (!Definition)
+		{
+			return;
+		}
+
+		BatchSpawn->SpawnMassDrop(Definition, Count, Spread, 2.0f, bBatched);
+
+		UE_LOG(LogTemp, Log, TEXT("UItemStackMergeSubsystem: drop em massa de %d itens '%s'"), Count, *Definition->ID.ToString());
+	}));
+
+static FAutoConsoleCommandWithWorld GItemStackMergeStatsCommand(
+	TEXT("Andromeda.Items.StackMergeStats"),
+	TEXT("Mostra candidatos pendentes e atores removidos pelo merge de pilhas"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		const UItemStackMergeSubsystem* StackMerge = World ? World->GetSubsystem<UItemStackMergeSubsystem>() : nullptr;
+		const UItemRegistrySubsystem* ItemRegistry = World ? World->GetSubsystem<UItemRegistrySubsystem>() : nullptr;
+		if (StackMerge && ItemRegistry)
+		{
+			UE_LOG(LogTemp, Log, TEXT("UItemStackMergeSubsystem: %d itens ativos, %d candidatos pendentes, %d atores removidos por merge"),
+				ItemRegistry->GetNumItems(), StackMerge->GetNumCandidates(), StackMerge->GetNumMergedActors());
+		}
+	}));
+
+bool UItemStackMergeSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Merge é decisão do servidor; clientes só recebem a quantidade nova e a remoção dos atores
+	const UWorld* World = Cast<UWorld>(Outer);
+	return Super::ShouldCreateSubsystem(Outer) && (!World || World->GetNetMode() != NM_Client);
+}
+
+void UItemStackMergeSubsystem::Deinitialize()
+{
+	Candidates.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UItemStackMergeSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UItemStackMergeSubsystem, STATGROUP_Tickables);
+}
+
+void UItemStackMergeSubsystem::AddCandidate(AMasterItem* Item)
+{
+	if (CVarItemStackMerge.GetValueOnGameThread() && CanMerge(Item))
+	{
+		Candidates.Add(Item);
+	}
+}
+
+bool UItemStackMergeSubsystem::CanMerge(const AMasterItem* Item)
+{
+	// Item ativo, empilhável, com espaço e sem player interagindo
+	const UItemDefinition* Definition = IsValid(Item) ? Item->GetDefinition() : nullptr;
+	if (!Definition || !Definition->STQty.Stackable || Item->IsInPool() || Item->IsActorBeingDestroyed()
+		|| Item->ItemRegistryHandle == INDEX_NONE || Item->OverlappingPlayers.Num() > 0)
+	{
+		return false;
+	}
+
+	// Receptor e doador assentados: itens do mesmo drop ainda caindo ou quicando ficam de fora
+	const UPrimitiveComponent* Body = Cast<UPrimitiveComponent>(Item->GetRootComponent());
+	return !(Item->ItemManager && Item->ItemManager->IsItemAwake(Item)) && !(Body && Body->IsSimulatingPhysics());
+}
+
+void UItemStackMergeSubsystem::Tick(float DeltaTime)
+{
+	SET_DWORD_STAT(STAT_ItemStackMergeCandidates, Candidates.Num());
+
+	TimeUntilMergePass -= DeltaTime;
+	if (TimeUntilMergePass > 0.0f || Candidates.Num() == 0)
+	{
+		return;
+	}
+	TimeUntilMergePass = CVarItemStackMergeInterval.GetValueOnGameThread();
+
+	SCOPE_CYCLE_COUNTER(STAT_ItemStackMergePass);
+
+	int32 NumProcessed = 0;
+	const int32 MaxPerPass = FMath::Max(1, CVarItemStackMergeMaxPerPass.GetValueOnGameThread());
+	for (auto It = Candidates.CreateIterator(); It && NumProcessed < MaxPerPass; ++It)
+	{
+		AMasterItem* Item = It->Get();
+		It.RemoveCurrent();
+
+		if (CanMerge(Item))
+		{
+			++NumProcessed;
+			const int32 NumRemoved = MergeAround(Item);
+			NumMergedActors += NumRemoved;
+			INC_DWORD_STAT_BY(STAT_ItemStackMergedActors, NumRemoved);
+		}
+	}
+}
+
+int32 UItemStackMergeSubsystem::MergeAround(AMasterItem* Receiver)
+{
+	UItemRegistrySubsystem* ItemRegistry = GetWorld()->GetSubsystem<UItemRegistrySubsystem>();
+	const int32 MaxQty = Receiver->GetDefinition()->STQty.MaxQty;
+	if (!ItemRegistry || Receiver->GetQuantity() >= MaxQty)
+	{
+		return 0;
+	}
+
+	FItemRegistryFilter Filter;
+	Filter.ID = Receiver->GetItemID();
+
+	TArray<AMasterItem*> Neighbours;
+	ItemRegistry->FindItemsInRange(Receiver->GetActorLocation(), CVarItemStackMergeRadius.GetValueOnGameThread(), Filter, Neighbours);
+
+	// Absorver primeiro as pilhas menores: mais atores removidos para a mesma quantidade
+	Neighbours.Sort([](const AMasterItem& A, const AMasterItem& B) { return A.GetQuantity() < B.GetQuantity(); });
+
+	UItemPoolSubsystem* Pool = GetWorld()->GetSubsystem<UItemPoolSubsystem>();
+	int32 NumRemoved = 0;
+	int32 ReceiverQuantity = Receiver->GetQuantity();
+	for (AMasterItem* Donor : Neighbours)
+	{
+		if (ReceiverQuantity >= MaxQty)
+		{
+			break;
+		}
+		if (Donor == Receiver || !CanMerge(Donor) || Donor->GetQuantity() >= MaxQty)
+		{
+			continue;
+		}
+
+		const int32 Transfer = FMath::Min(MaxQty - ReceiverQuantity, Donor->GetQuantity());
+		ReceiverQuantity += Transfer;
+
+		if (Transfer == Donor->GetQuantity())
+		{
+			// Doador vazio: sai do mundo (o canal do ator fecha nos clientes)
+			Candidates.Remove(Donor);
+			if (Pool)
+			{
+				Pool->ReleaseItem(Donor);
+			}
+			else
+			{
+				Donor->Destroy();
+			}
+			++NumRemoved;
+		}
+		else
+		{
+			Donor->SetQuantity(Donor->GetQuantity() - Transfer);
+		}
+	}
+
+	// Uma única atualização de quantidade para o receptor
+	Receiver->SetQuantity(ReceiverQuantity);
+	return NumRemoved;
+}
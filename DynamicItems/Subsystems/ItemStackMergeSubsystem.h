@@ -0,0 +1,44 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemStackMerge
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ItemStackMergeSubsystem.generated.h"
+
+class AMasterItem;
+
+/**
+ * Junta itens empilháveis iguais (mesmo ID) que assentaram próximos em um único ator, até STQty.MaxQty
+ * Só existe com autoridade: a quantidade replica por SetQuantity e os atores absorvidos voltam ao pool
+ * Apenas itens que acabaram de assentar são candidatos; não há varredura do mundo
+ */
+UCLASS()
+class ANDROMEDA_API UItemStackMergeSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Chamado quando o item assenta (AMasterItem::CheckSettled)
+	void AddCandidate(AMasterItem* Item);
+
+	FORCEINLINE int32 GetNumCandidates() const { return Candidates.Num(); }
+	FORCEINLINE int32 GetNumMergedActors() const { return NumMergedActors; }
+
+private:
+	// Absorve vizinhos no Receiver; retorna quantos atores foram removidos
+	int32 MergeAround(AMasterItem* Receiver);
+	static bool CanMerge(const AMasterItem* Item);
+
+	TSet<TWeakObjectPtr<AMasterItem>> Candidates;
+	float TimeUntilMergePass = 0.0f;
+	int32 NumMergedActors = 0;
+};
@@ -0,0 +1,151 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemWidget
+
+#include "ItemWidgetSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/MasterItem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/ItemStats.h"
+#include "AndromedaSystemsC/DynamicItems/Data/ItemDefinition.h"
+#include "Blueprint/UserWidget.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+
+DECLARE_CYCLE_STAT(TEXT("Widget Update"), STAT_ItemWidgetUpdate, STATGROUP_AndromedaItems);
+
+bool UItemWidgetSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Servidor dedicado não tem player local nem viewport
+	return Super::ShouldCreateSubsystem(Outer) && !IsRunningDedicatedServer();
+}
+
+void UItemWidgetSubsystem::Deinitialize()
+{
+	for (const TPair<TSubclassOf<UUserWidget>, TObjectPtr<UUserWidget>>& Pair : WidgetsByClass)
+	{
+		if (Pair.Value)
+		{
+			Pair.Value->RemoveFromParent();
+		}
+	}
+
+	WidgetsByClass.Reset();
+	InstructionWidget = nullptr;
+	PickupWidget = nullptr;
+	FocusedItem.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UItemWidgetSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UItemWidgetSubsystem, STATGROUP_Tickables);
+}
+
+void UItemWidgetSubsystem::SetFocusedItem(AMasterItem* Item)
+{
+	if (!Item || FocusedItem.Get() == Item)
+	{
+		return;
+	}
+
+	HideWidgets();
+	FocusedItem = Item;
+
+	APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	const UItemDefinition* Definition = Item->GetDefinition();
+	if (!PlayerController || !Definition)
+	{
+		return;
+	}
+
+	InstructionWidget = AcquireWidget(Definition->WidgetsSettings.WidgetInstruction, PlayerController);
+	PickupWidget = AcquireWidget(Definition->WidgetsSettings.WidgetPickup, PlayerController);
+}
+
+void UItemWidgetSubsystem::ClearFocusedItem(AMasterItem* Item)
+{
+	if (FocusedItem.Get() == Item)
+	{
+		HideWidgets();
+		FocusedItem.Reset();
+	}
+}
+
+UUserWidget* UItemWidgetSubsystem::AcquireWidget(TSubclassOf<UUserWidget> WidgetClass, APlayerController* PlayerController)
+{
+	if (!WidgetClass)
+	{
+		return nullptr;
+	}
+
+	TObjectPtr<UUserWidget>& Widget = WidgetsByClass.FindOrAdd(WidgetClass);
+	if (!Widget)
+	{
+		Widget = CreateWidget<UUserWidget>(PlayerController, WidgetClass);
+		if (Widget)
+		{
+			Widget->SetAlignmentInViewport(FVector2D(0.5f, 0.5f));
+			Widget->AddToViewport();
+			Widget->SetVisibility(ESlateVisibility::Collapsed);
+		}
+	}
+	return Widget;
+}
+
+void UItemWidgetSubsystem::HideWidgets()
+{
+	if (InstructionWidget)
+	{
+		InstructionWidget->SetVisibility(ESlateVisibility::Collapsed);
+	}
+	if (PickupWidget)
+	{
+		PickupWidget->SetVisibility(ESlateVisibility::Collapsed);
+	}
+	InstructionWidget = nullptr;
+	PickupWidget = nullptr;
+}
+
+void UItemWidgetSubsystem::PlaceWidget(UUserWidget* Widget, APlayerController* PlayerController, const FVector& WorldLocation, const FVector2D& Size) const
+{
+	if (!Widget)
+	{
+		return;
+	}
+
+	// Mesma projeção de um UWidgetComponent em espaço de tela; fora da câmera o widget é escondido
+	FVector2D ScreenPosition;
+	if (UGameplayStatics::ProjectWorldToScreen(PlayerController, WorldLocation, ScreenPosition, true))
+	{
+		Widget->SetDesiredSizeInViewport(Size);
+		Widget->SetPositionInViewport(ScreenPosition, false);
+		Widget->SetVisibility(ESlateVisibility::HitTestInvisible);
+	}
+	else
+	{
+		Widget->SetVisibility(ESlateVisibility::Collapsed);
+	}
+}
+
+void UItemWidgetSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ItemWidgetUpdate);
+
+	if (!InstructionWidget && !PickupWidget)
+	{
+		return;
+	}
+
+	AMasterItem* Item = FocusedItem.Get();
+	APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	const UItemDefinition* Definition = Item ? Item->GetDefinition() : nullptr;
+	if (!Definition || !PlayerController || !PlayerController->GetPawn())
+	{
+		HideWidgets();
+		FocusedItem.Reset();
+		return;
+	}
+
+	// Instrução fica fixa no mundo; pickup acompanha o item
+	PlaceWidget(InstructionWidget, PlayerController, Item->GetWidgetInstructionWorldLocation(), Definition->WidgetsSettings.WidgetInstructionSize);
+	PlaceWidget(PickupWidget, PlayerController, Item->GetActorTransform().TransformPosition(Definition->WidgetsSettings.WidgetPickupPosition), Definition->WidgetsSettings.WidgetPickupSize);
+}
@@ -0,0 +1,54 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemWidget
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ItemWidgetSubsystem.generated.h"
+
+class AMasterItem;
+class APlayerController;
+class UUserWidget;
+
+/**
+ * Widgets de interação do player local (instrução e pickup)
+ * Uma única instância de cada classe de widget, movida para o item focado
+ * Substitui os dois UWidgetComponent que cada AMasterItem carregava
+ */
+UCLASS()
+class ANDROMEDA_API UItemWidgetSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Chamados pelo item quando o player local entra/sai do alcance
+	void SetFocusedItem(AMasterItem* Item);
+	void ClearFocusedItem(AMasterItem* Item);
+
+	FORCEINLINE AMasterItem* GetFocusedItem() const { return FocusedItem.Get(); }
+
+private:
+	UUserWidget* AcquireWidget(TSubclassOf<UUserWidget> WidgetClass, APlayerController* PlayerController);
+	void PlaceWidget(UUserWidget* Widget, APlayerController* PlayerController, const FVector& WorldLocation, const FVector2D& Size) const;
+	void HideWidgets();
+
+	TWeakObjectPtr<AMasterItem> FocusedItem;
+
+	// Pool de widgets por classe: criados uma vez e reaproveitados entre itens
+	UPROPERTY(Transient)
+	TMap<TSubclassOf<UUserWidget>, TObjectPtr<UUserWidget>> WidgetsByClass;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UUserWidget> InstructionWidget;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UUserWidget> PickupWidget;
+};
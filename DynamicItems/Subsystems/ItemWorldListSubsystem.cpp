@@ -0,0 +1,258 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemWorldList
+
+#include "ItemWorldListSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/MasterItem.h"
+#include "AndromedaSystemsC/DynamicItems/Core/ItemStats.h"
+#include "AndromedaSystemsC/DynamicItems/Data/ItemDefinition.h"
+#include "AndromedaSystemsC/DynamicItems/Data/ItemReplicationSettings.h"
+#include "AndromedaSystemsC/DynamicItems/Networking/ItemWorldListActor.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemDefinitionRegistry.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemInstancedRenderSubsystem.h"
+#include "AndromedaSystemsC/DynamicItems/Subsystems/ItemMeshLoaderSubsystem.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("World List Entries"), STAT_ItemWorldListEntries, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("World List Cells"), STAT_ItemWorldListCells, STATGROUP_AndromedaItems);
+DECLARE_DWORD_COUNTER_STAT(TEXT("World List Records (Client)"), STAT_ItemWorldListRecords, STATGROUP_AndromedaItems);
+
+static TAutoConsoleVariable<bool> CVarItemWorldList(
+	TEXT("andromeda.Items.WorldList"),
+	true,
+	TEXT("Se verdadeiro, itens estáticos assentados saem da replicação como atores e são replicados como registros na lista da célula."),
+	ECVF_Default);
+
+// Medição (listen server + cliente, ex: Andromeda.Items.NetBenchmark 20000 <ItemID> e "stat net" nos dois lados)
+// Compare canais abertos e bytes enviados com andromeda.Items.WorldList 1 e 0
+static FAutoConsoleCommandWithWorld GItemWorldListStatsCommand(
+	TEXT("Andromeda.Items.WorldListStats"),
+	TEXT("Mostra registros e células da lista replicada e quantos atores de item ainda replicam"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		const UItemWorldListSubsystem* WorldList = World ? World->GetSubsystem<UItemWorldListSubsystem>() : nullptr;
+		if (!WorldList)
+		{
+			return;
+		}
+
+		int32 NumItemActors = 0;
+		int32 NumReplicatedItemActors = 0;
+		for (TActorIterator<AMasterItem> It(World); It; ++It)
+		{
+			++NumItemActors;
+			NumReplicatedItemActors += It->GetIsReplicated() ? 1 : 0;
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("UItemWorldListSubsystem: %d entradas em %d células, %d/%d atores de item replicando, %d registros apresentados no cliente"),
+			WorldList->GetNumEntries(), WorldList->GetNumCells(), NumReplicatedItemActors, NumItemActors, WorldList->GetNumRecords());
+	}));
+
+void UItemWorldListSubsystem::Deinitialize()
+{
+	Cells.Reset();
+	Records.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UItemWorldListSubsystem::AddItem(AMasterItem* Item)
+{
+	// Só itens estáticos sem efeitos contínuos; atores do mapa continuam existindo no cliente e ficam de fora
+	const UItemDefinition* Definition = Item ? Item->GetDefinition() : nullptr;
+	if (!CVarItemWorldList.GetValueOnGameThread() || !Definition || Item->IsInWorldList() || Item->IsNetStartupActor()
+		|| Definition->STModel.MeshType != EMeshType::Static || Item->bEasyMode)
+	{
+		return false;
+	}
+
+	AItemWorldListActor* ListActor = GetOrCreateCellActor(Item->GetActorLocation());
+	if (!ListActor)
+	{
+		return false;
+	}
+
+	ListActor->AddItem(Item);
+
+	// O canal do ator fecha e o cliente passa a ver apenas o registro
+	Item->SetReplicates(false);
+
+	SET_DWORD_STAT(STAT_ItemWorldListEntries, GetNumEntries());
+	return true;
+}
+
+void UItemWorldListSubsystem::UpdateItem(AMasterItem* Item)
+{
+	if (Item && Item->WorldListActor)
+	{
+		Item->WorldListActor->UpdateItem(Item);
+	}
+}
+
+void UItemWorldListSubsystem::RemoveItem(AMasterItem* Item)
+{
+	if (Item && Item->WorldListActor)
+	{
+		Item->WorldListActor->RemoveItem(Item);
+		SET_DWORD_STAT(STAT_ItemWorldListEntries, GetNumEntries());
+	}
+}
+
+int32 UItemWorldListSubsystem::GetNumEntries() const
+{
+	int32 NumEntries = 0;
+	for (const TPair<FIntPoint, TObjectPtr<AItemWorldListActor>>& Cell : Cells)
+	{
+		NumEntries += Cell.Value ? Cell.Value->GetNumEntries() : 0;
+	}
+	return NumEntries;
+}
+
+AItemWorldListActor* UItemWorldListSubsystem::GetOrCreateCellActor(const FVector& Location)
+{
+	// Mesma célula da grade de itens do UAndromedaReplicationGraph
+	const float CellSize = GetDefault<UItemReplicationSettings>()->ItemGridCellSize;
+	const FIntPoint Cell(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+	if (const TObjectPtr<AItemWorldListActor>* ExistingActor = Cells.Find(Cell))
+	{
+		if (IsValid(*ExistingActor))
+		{
+			return *ExistingActor;
+		}
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.ObjectFlags |= RF_Transient;
+	const FVector CellCenter((Cell.X + 0.5f) * CellSize, (Cell.Y + 0.5f) * CellSize, Location.Z);
+	AItemWorldListActor* ListActor = World->SpawnActor<AItemWorldListActor>(AItemWorldListActor::StaticClass(), FTransform(CellCenter), SpawnParameters);
+	if (ListActor)
+	{
+		Cells.Add(Cell, ListActor);
+		SET_DWORD_STAT(STAT_ItemWorldListCells, Cells.Num());
+	}
+
+	return ListActor;
+}
+
+uint64 UItemWorldListSubsystem::MakeRecordKey(const AItemWorldListActor* ListActor, int32 ReplicationID)
+{
+	return (static_cast<uint64>(ListActor->GetUniqueID()) << 32) | static_cast<uint32>(ReplicationID);
+}
+
+void UItemWorldListSubsystem::OnEntryAdded(const AItemWorldListActor* ListActor, const FItemWorldListEntry& Entry)
+{
+	UItemDefinitionRegistry* Registry = UItemDefinitionRegistry::Get(GetWorld());
+	const UItemDefinition* Definition = Registry ? Registry->FindDefinition(Entry.ID) : nullptr;
+	if (!ListActor || !Definition)
+	{
+		return;
+	}
+
+	const uint64 Key = MakeRecordKey(ListActor, Entry.ReplicationID);
+	FItemWorldRecord& Record = Records.FindOrAdd(Key);
+	Record.Scale = Definition->STModel.Size;
+	Record.Transform = Entry.GetTransform(Record.Scale);
+	SET_DWORD_STAT(STAT_ItemWorldListRecords, Records.Num());
+
+	// Mesh já carregado entra direto; senão a instância aparece quando o carregamento terminar
+	if (UStaticMesh* Mesh = Definition->STModel.StaticMesh.Get())
+	{
+		AddRecordInstance(Key, Record, Mesh);
+	}
+	else if (UItemMeshLoaderSubsystem* MeshLoader = GetWorld()->GetSubsystem<UItemMeshLoaderSubsystem>())
+	{
+		MeshLoader->RequestMesh(Definition->STModel.StaticMesh.ToSoftObjectPath(), Definition->STModel.MeshLoadPriority,
+			FOnItemMeshLoaded::CreateUObject(this, &UItemWorldListSubsystem::OnRecordMeshLoaded, Key));
+	}
+}
+
+void UItemWorldListSubsystem::OnEntryChanged(const AItemWorldListActor* ListActor, const FItemWorldListEntry& Entry)
+{
+	FItemWorldRecord* Record = ListActor ? Records.Find(MakeRecordKey(ListActor, Entry.ReplicationID)) : nullptr;
+	if (!Record)
+	{
+		OnEntryAdded(ListActor, Entry);
+		return;
+	}
+
+	// Quantidade não muda a apresentação; só a transformação
+	Record->Transform = Entry.GetTransform(Record->Scale);
+	UItemInstancedRenderSubsystem* InstancedRender = GetWorld()->GetSubsystem<UItemInstancedRenderSubsystem>();
+	if (InstancedRender && Record->InstanceIndex != INDEX_NONE)
+	{
+		InstancedRender->UpdateInstance(Record->Mesh, Record->InstanceIndex, Record->Transform);
+	}
+}
+
+void UItemWorldListSubsystem::OnEntryRemoved(const AItemWorldListActor* ListActor, const FItemWorldListEntry& Entry)
+{
+	FItemWorldRecord Record;
+	if (ListActor && Records.RemoveAndCopyValue(MakeRecordKey(ListActor, Entry.ReplicationID), Record))
+	{
+		RemoveRecordInstance(Record);
+		SET_DWORD_STAT(STAT_ItemWorldListRecords, Records.Num());
+	}
+}
+
+void UItemWorldListSubsystem::OnListActorRemoved(const AItemWorldListActor* ListActor)
+{
+	for (const FItemWorldListEntry& Entry : ListActor->GetEntries())
+	{
+		OnEntryRemoved(ListActor, Entry);
+	}
+}
+
+void UItemWorldListSubsystem::OnRecordMeshLoaded(UObject* LoadedObject, uint64 Key)
+{
+	// O registro pode ter sido removido enquanto o mesh carregava
+	FItemWorldRecord* Record = Records.Find(Key);
+	UStaticMesh* Mesh = Cast<UStaticMesh>(LoadedObject);
+	if (Record && Mesh && Record->InstanceIndex == INDEX_NONE)
+	{
+		AddRecordInstance(Key, *Record, Mesh);
+	}
+}
+
+void UItemWorldListSubsystem::AddRecordInstance(uint64 Key, FItemWorldRecord& Record, UStaticMesh* Mesh)
+{
+	// Mesmos batches dos itens colapsados: um HISM por mesh, independente da origem da instância
+	UItemInstancedRenderSubsystem* InstancedRender = GetWorld()->GetSubsystem<UItemInstancedRenderSubsystem>();
+	if (!InstancedRender)
+	{
+		return;
+	}
+
+	FItemInstanceOwner Owner;
+	Owner.RecordKey = Key;
+	const int32 InstanceIndex = InstancedRender->AddInstance(Mesh, Record.Transform, Owner);
+	if (InstanceIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	Record.Mesh = Mesh;
+	Record.InstanceIndex = InstanceIndex;
+}
+
+void UItemWorldListSubsystem::RemoveRecordInstance(const FItemWorldRecord& Record)
+{
+	if (UItemInstancedRenderSubsystem* InstancedRender = GetWorld()->GetSubsystem<UItemInstancedRenderSubsystem>())
+	{
+		InstancedRender->RemoveInstance(Record.Mesh, Record.InstanceIndex);
+	}
+}
+
+void UItemWorldListSubsystem::OnRecordInstanceMoved(uint64 Key, int32 NewInstanceIndex)
+{
+	if (FItemWorldRecord* Record = Records.Find(Key))
+	{
+		Record->InstanceIndex = NewInstanceIndex;
+	}
+}
@@ -0,0 +1,68 @@
+// Dynamic item system // Version 1.0.0 // date: 2026-10-16 // last update: 2026-10-16 // Author: Pilha-DS // Subsystem: ItemWorldList
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ItemWorldListSubsystem.generated.h"
+
+class AMasterItem;
+class AItemWorldListActor;
+class UStaticMesh;
+struct FItemWorldListEntry;
+
+/**
+ * Lista replicada dos itens assentados (andromeda.Items.WorldList)
+ * Servidor: tira o ator do item da replicação e publica um registro no AItemWorldListActor da célula
+ * Cliente: cada registro vira uma instância nos batches do UItemInstancedRenderSubsystem; o ator completo volta quando o servidor acorda o item
+ */
+UCLASS()
+class ANDROMEDA_API UItemWorldListSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem
+	virtual void Deinitialize() override;
+
+	// Servidor: retorna falso quando o item não pode entrar na lista (continua como ator dormente)
+	bool AddItem(AMasterItem* Item);
+	void UpdateItem(AMasterItem* Item);
+	void RemoveItem(AMasterItem* Item);
+
+	// Cliente: chamados pelos callbacks do FItemWorldList
+	void OnEntryAdded(const AItemWorldListActor* ListActor, const FItemWorldListEntry& Entry);
+	void OnEntryChanged(const AItemWorldListActor* ListActor, const FItemWorldListEntry& Entry);
+	void OnEntryRemoved(const AItemWorldListActor* ListActor, const FItemWorldListEntry& Entry);
+	void OnListActorRemoved(const AItemWorldListActor* ListActor);
+
+	// Chamado pelo UItemInstancedRenderSubsystem quando a remoção com swap muda a instância do registro
+	void OnRecordInstanceMoved(uint64 Key, int32 NewInstanceIndex);
+
+	int32 GetNumEntries() const;
+	FORCEINLINE int32 GetNumCells() const { return Cells.Num(); }
+	FORCEINLINE int32 GetNumRecords() const { return Records.Num(); }
+
+private:
+	struct FItemWorldRecord
+	{
+		UStaticMesh* Mesh = nullptr; // Mantido vivo pelo HISM do batch compartilhado
+		int32 InstanceIndex = INDEX_NONE;
+		FVector Scale = FVector::OneVector;
+		FTransform Transform;
+	};
+
+	static uint64 MakeRecordKey(const AItemWorldListActor* ListActor, int32 ReplicationID);
+
+	AItemWorldListActor* GetOrCreateCellActor(const FVector& Location);
+	void OnRecordMeshLoaded(UObject* LoadedObject, uint64 Key);
+	void AddRecordInstance(uint64 Key, FItemWorldRecord& Record, UStaticMesh* Mesh);
+	void RemoveRecordInstance(const FItemWorldRecord& Record);
+
+	// Servidor: um ator de lista por célula da grade de replicação de itens
+	UPROPERTY(Transient)
+	TMap<FIntPoint, TObjectPtr<AItemWorldListActor>> Cells;
+
+	// Cliente
+	TMap<uint64, FItemWorldRecord> Records;
+};